@@ -0,0 +1,315 @@
+#include "Balayage.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <future>
+#include <iomanip>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include "ContratException.h"
+#include "Politiques.h"
+#include "Simulation.h"
+
+namespace {
+    /**
+     * \brief Nombre de fins de processus entre deux consultations du front de Pareto.
+     */
+    const size_t PAS_VERIFICATION = 1024;
+
+    /**
+     * \brief Réglages complets non dominés, partagés entre les simulations en cours.
+     */
+    class FrontPareto {
+    public:
+        /**
+         * \brief Vérifie si un réglage du front domine les bornes données.
+         */
+        bool domineBornes(const MesureReglage& bornes) const {
+            std::lock_guard<std::mutex> garde(m_verrou);
+            return std::any_of(m_points.begin(), m_points.end(),
+                               [&bornes](const MesureReglage& point) { return domine(point, bornes); });
+        }
+
+        /**
+         * \brief Ajoute un réglage complet, et retire du front ceux qu'il domine.
+         */
+        void ajouter(const MesureReglage& mesure) {
+            std::lock_guard<std::mutex> garde(m_verrou);
+            for (const MesureReglage& point : m_points) {
+                if (domine(point, mesure)) return;
+            }
+            m_points.erase(std::remove_if(m_points.begin(), m_points.end(),
+                                          [&mesure](const MesureReglage& point) { return domine(mesure, point); }),
+                           m_points.end());
+            m_points.push_back(mesure);
+        }
+
+    private:
+        mutable std::mutex m_verrou;
+        std::vector<MesureReglage> m_points;
+    };
+
+    /**
+     * \brief Ce que toutes les politiques conservatrices ont en commun sur une charge.
+     *
+     *        Un processeur qui ne reste jamais inactif quand un processus est
+     *        arrivé a, à tout instant, le même travail en retard quelle que soit
+     *        la politique : c'est celui de FCFS. Pour les arrivées triées, vide[j]
+     *        est l'instant où ce travail s'épuiserait sans la (j+1)-ième arrivée,
+     *        et cumul[j] la somme des arrivée + durée des j+1 premières.
+     */
+    struct Charge {
+        std::vector<int> arrivee;
+        std::vector<long long> vide;
+        std::vector<long long> cumul;
+
+        Charge(const TableProcessus& table, int temps) {
+            std::vector<uint32_t> ordre(table.taille());
+            std::iota(ordre.begin(), ordre.end(), 0u);
+            const std::vector<int>& arrivees = table.arrivees();
+            std::sort(ordre.begin(), ordre.end(),
+                      [&arrivees](uint32_t a, uint32_t b) { return arrivees[a] < arrivees[b]; });
+            long long horloge = temps;
+            long long somme = 0;
+            for (uint32_t i : ordre) {
+                horloge = std::max(horloge, static_cast<long long>(arrivees[i])) + table.durees()[i];
+                somme += static_cast<long long>(arrivees[i]) + table.durees()[i];
+                arrivee.push_back(arrivees[i]);
+                vide.push_back(horloge);
+                cumul.push_back(somme);
+            }
+        }
+
+        /**
+         * \brief Durée minimale de la simulation : la dernière fin de FCFS.
+         */
+        long long dureeMinimale(int temps) const {
+            return vide.empty() ? 0 : vide.back() - temps;
+        }
+
+        /**
+         * \brief Nombre de processus arrivés à l'instant horloge.
+         */
+        size_t arrives(int horloge) const {
+            return static_cast<size_t>(std::upper_bound(arrivee.begin(), arrivee.end(), horloge) - arrivee.begin());
+        }
+
+        /**
+         * \brief Borne inférieure de la somme des attentes, sachant que termines
+         *        processus ont fini à l'instant horloge, la somme de leurs fins étant sommeFins.
+         *
+         *        Un processus arrivé mais pas terminé finit au plus tôt à horloge plus
+         *        son temps restant, et la somme de ces restants est le travail en retard.
+         *        Le reste de la somme se déduit des cumuls : attente = fin − arrivée − durée.
+         */
+        long long borneAttente(long long sommeFins, size_t termines, int horloge) const {
+            size_t k = arrives(horloge);
+            if (k == 0) return 0;
+            long long retard = std::max(0LL, vide[k - 1] - horloge);
+            return sommeFins + static_cast<long long>(k - termines) * horloge + retard - cumul[k - 1];
+        }
+    };
+
+    /**
+     * \brief Critère d'arrêt de simuler() : cumule les mesures à chaque fin et abandonne
+     *        la simulation dès que ses bornes inférieures sont dominées par le front.
+     *
+     *        La somme des attentes est minorée par Charge::borneAttente(). Les m
+     *        plus longues attentes terminées sont gardées dans un tas, m étant le
+     *        nombre d'attentes supérieures ou égales au 99e centile : dès que le tas
+     *        est plein, son minimum minore le centile final, et l'égale une fois
+     *        tous les processus terminés.
+     *
+     */
+    struct Elagage {
+        const TableProcessus* table;
+        const Charge* charge;
+        const FrontPareto* front;
+        MesureReglage mesure;
+        size_t m;
+        int temps;
+        long long sommeFins;
+        std::vector<int> plusLongues;   // Tas, minimum au sommet.
+
+        bool operator()(uint32_t i, int horloge) {
+            int attente = table->attentes()[i];
+            mesure.sommeAttente += attente;
+            sommeFins += horloge;
+            ++mesure.termines;
+            if (plusLongues.size() < m) {
+                plusLongues.push_back(attente);
+                std::push_heap(plusLongues.begin(), plusLongues.end(), std::greater<int>());
+            } else if (attente > plusLongues.front()) {
+                std::pop_heap(plusLongues.begin(), plusLongues.end(), std::greater<int>());
+                plusLongues.back() = attente;
+                std::push_heap(plusLongues.begin(), plusLongues.end(), std::greater<int>());
+            }
+            if (plusLongues.size() == m) mesure.attenteP99 = plusLongues.front();
+            mesure.duree = std::max(mesure.duree, static_cast<long long>(horloge) - temps);
+
+            if (front == nullptr || mesure.termines == mesure.processus ||
+                mesure.termines % PAS_VERIFICATION != 0) {
+                return false;
+            }
+            MesureReglage bornes = mesure;
+            bornes.sommeAttente = std::max(mesure.sommeAttente,
+                                           charge->borneAttente(sommeFins, mesure.termines, horloge));
+            if (!front->domineBornes(bornes)) return false;
+            mesure = bornes;
+            return true;
+        }
+    };
+
+    /**
+     * \brief Simule un réglage sur sa propre copie de la charge.
+     */
+    MesureReglage mesurer(const TableProcessus& source, const Charge& charge, const Reglage& reglage,
+                          const FrontPareto* front, int temps, const CoutCommutation& commutation) {
+        TableProcessus table = source;
+        size_t n = table.taille();
+        size_t rang = static_cast<size_t>(std::ceil(0.99 * static_cast<double>(n)));
+
+        Elagage elagage{&table, &charge, front,
+                        MesureReglage{reglage, false, false, n, 0, 0, 0, charge.dureeMinimale(temps), {}},
+                        n == 0 ? 0 : n - std::max<size_t>(rang, 1) + 1, temps, 0, {}};
+        switch (reglage.politique) {
+            case PolitiqueBalayee::TOURNIQUET: {
+                PolitiqueTourniquet politique(reglage.quantum);
+                simuler(table, politique, temps, elagage, commutation, &elagage.mesure.processeur);
+                break;
+            }
+            case PolitiqueBalayee::MULTINIVEAUX: {
+                PolitiqueMultiniveaux politique(table, reglage.quantum);
+                simuler(table, politique, temps, elagage, commutation, &elagage.mesure.processeur);
+                break;
+            }
+            case PolitiqueBalayee::MLFQ: {
+                int q = reglage.quantum;
+                PolitiqueMlfq politique(table, {q, 2 * q, 4 * q, 8 * q}, reglage.relevement);
+                simuler(table, politique, temps, elagage, commutation, &elagage.mesure.processeur);
+                break;
+            }
+        }
+        elagage.mesure.complet = elagage.mesure.termines == n;
+        return elagage.mesure;
+    }
+}
+
+/**
+ * \brief Nom lisible du réglage, par exemple "mlfq q=4 r=50".
+ */
+std::string Reglage::nom() const {
+    std::ostringstream os;
+    switch (politique) {
+        case PolitiqueBalayee::TOURNIQUET:
+            os << "round_robin q=" << quantum;
+            break;
+        case PolitiqueBalayee::MULTINIVEAUX:
+            os << "multiniveaux q=" << quantum;
+            break;
+        case PolitiqueBalayee::MLFQ:
+            os << "mlfq q=" << quantum << " r=" << relevement;
+            break;
+    }
+    return os.str();
+}
+
+/**
+ * \brief Temps d'attente moyen (borne inférieure si le réglage a été abandonné).
+ */
+double MesureReglage::attenteMoyenne() const {
+    return processus == 0 ? 0 : static_cast<double>(sommeAttente) / static_cast<double>(processus);
+}
+
+/**
+ * \brief Processus terminés par unité de temps (borne supérieure si le réglage a été abandonné).
+ */
+double MesureReglage::debit() const {
+    return duree == 0 ? 0 : static_cast<double>(processus) / static_cast<double>(duree);
+}
+
+/**
+ * \brief Dominance de Pareto : a n'est pire que b sur aucun critère (attente moyenne,
+ *        99e centile de l'attente, débit) et meilleur sur au moins un.
+ */
+bool domine(const MesureReglage& a, const MesureReglage& b) {
+    bool pasPire = a.sommeAttente <= b.sommeAttente && a.attenteP99 <= b.attenteP99 && a.duree <= b.duree;
+    bool meilleur = a.sommeAttente < b.sommeAttente || a.attenteP99 < b.attenteP99 || a.duree < b.duree;
+    return pasPire && meilleur;
+}
+
+/**
+ * \brief Évalue une grille de réglages en parallèle sur une même charge.
+ *
+ *        Chaque réglage devient une tâche du pool, qui copie la charge (partagée
+ *        en lecture seule entre les tâches) et la simule. Avec elaguer, les
+ *        réglages terminés forment un front de Pareto commun ; une simulation en
+ *        cours le consulte toutes les PAS_VERIFICATION fins et s'arrête dès que ses
+ *        bornes inférieures y sont dominées, puisque son résultat final le serait
+ *        aussi. Quel que soit l'ordre d'exécution, un réglage du front final n'est
+ *        jamais abandonné : les réglages marqués pareto sont les mêmes avec ou
+ *        sans élagage. Les bornes supposent des processus de pur calcul : une
+ *        charge qui fait des entrées-sorties est toujours simulée jusqu'au bout.
+ *
+ * \param[in] charge Les processus, non modifiés.
+ * \param[in] grille Les réglages à évaluer.
+ * \param[in] pool Le pool qui exécute les simulations.
+ * \param[in] temps L'instant de départ de l'horloge.
+ * \param[in] elaguer Vrai pour abandonner les réglages dominés (sans effet si la charge fait des entrées-sorties).
+ * \param[in] commutation Coût d'une commutation de contexte, payé par tous les réglages ; les
+ *            bornes de l'élagage restent valides, une commutation ne pouvant que retarder les fins.
+ * \return Une mesure par réglage, dans l'ordre de la grille.
+ * \pre temps >= 0
+ */
+std::vector<MesureReglage> balayer(const TableProcessus& charge, const std::vector<Reglage>& grille,
+                                   PoolTaches& pool, int temps, bool elaguer, const CoutCommutation& commutation) {
+    PRECONDITION(temps >= 0);
+
+    const Charge commune(charge, temps);
+    FrontPareto front;
+    elaguer = elaguer && !charge.aDesEntreesSorties();
+    std::vector<std::future<MesureReglage>> enCours;
+    enCours.reserve(grille.size());
+    for (const Reglage& reglage : grille) {
+        enCours.push_back(pool.soumettre([&charge, &commune, reglage, &front, elaguer, temps, &commutation]() {
+            MesureReglage mesure = mesurer(charge, commune, reglage, elaguer ? &front : nullptr, temps, commutation);
+            if (mesure.complet) front.ajouter(mesure);
+            return mesure;
+        }));
+    }
+
+    std::vector<MesureReglage> mesures;
+    mesures.reserve(grille.size());
+    for (std::future<MesureReglage>& mesure : enCours) mesures.push_back(mesure.get());
+
+    for (MesureReglage& mesure : mesures) {
+        mesure.pareto = mesure.complet &&
+                        std::none_of(mesures.begin(), mesures.end(), [&mesure](const MesureReglage& autre) {
+                            return autre.complet && domine(autre, mesure);
+                        });
+    }
+    return mesures;
+}
+
+/**
+ * \brief Tableau des mesures, une ligne par réglage.
+ *
+ *        La colonne état vaut "pareto" pour un réglage non dominé, "domine" pour
+ *        un réglage complet dominé et "abandonne" pour un réglage arrêté par
+ *        élagage ; les mesures de ce dernier sont alors des bornes.
+ */
+std::string formaterBalayage(const std::vector<MesureReglage>& mesures) {
+    std::ostringstream os;
+    os << std::left << std::setw(24) << "reglage" << std::right << std::setw(18) << "attente moyenne"
+       << std::setw(14) << "attente p99" << std::setw(12) << "debit" << std::setw(14) << "commutations"
+       << std::setw(12) << "etat" << std::endl;
+    for (const MesureReglage& mesure : mesures) {
+        os << std::left << std::setw(24) << mesure.reglage.nom() << std::right << std::fixed << std::setprecision(2)
+           << std::setw(18) << mesure.attenteMoyenne() << std::setw(14) << mesure.attenteP99
+           << std::setprecision(4) << std::setw(12) << mesure.debit()
+           << std::setw(14) << mesure.processeur.commutations
+           << std::setw(12) << (mesure.pareto ? "pareto" : mesure.complet ? "domine" : "abandonne") << std::endl;
+    }
+    return os.str();
+}
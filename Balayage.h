@@ -0,0 +1,68 @@
+//
+// Created by Vincent on 10/1/2024.
+//
+
+#ifndef BALAYAGE_H
+#define BALAYAGE_H
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "PoolTaches.h"
+#include "Simulation.h"
+#include "TableProcessus.h"
+
+/**
+ * \enum PolitiqueBalayee
+ * \brief Politiques dont les paramètres peuvent être balayés.
+ */
+enum class PolitiqueBalayee {
+  TOURNIQUET,
+  MULTINIVEAUX,
+  MLFQ
+};
+
+/**
+ * \brief Un point de la grille : une politique et ses paramètres.
+ *
+ *        Pour MLFQ, les quanta des quatre niveaux valent quantum × {1, 2, 4, 8},
+ *        comme dans simulateur.cpp ; relevement n'est lu que pour MLFQ.
+ */
+struct Reglage {
+  PolitiqueBalayee politique;
+  int quantum;
+  int relevement;
+
+  std::string nom() const;
+};
+
+/**
+ * \brief Mesures d'un réglage sur la charge balayée.
+ *
+ *        Pour un réglage abandonné (complet == false), sommeAttente, attenteP99,
+ *        duree et processeur.commutations sont des bornes inférieures des valeurs
+ *        qu'aurait données la simulation complète : un réglage complet les domine.
+ */
+struct MesureReglage {
+  Reglage reglage;
+  bool complet;
+  bool pareto;              ///< Réglage complet qu'aucun autre réglage complet ne domine.
+  size_t processus;
+  size_t termines;
+  long long sommeAttente;
+  int attenteP99;
+  long long duree;          ///< De l'instant de départ à la dernière fin.
+  BilanProcesseur processeur;
+
+  double attenteMoyenne() const;
+  double debit() const;
+};
+
+bool domine(const MesureReglage& a, const MesureReglage& b);
+
+std::vector<MesureReglage> balayer(const TableProcessus& charge, const std::vector<Reglage>& grille,
+                                   PoolTaches& pool, int temps, bool elaguer = true,
+                                   const CoutCommutation& commutation = CoutCommutation());
+
+std::string formaterBalayage(const std::vector<MesureReglage>& mesures);
+
+#endif //BALAYAGE_H
@@ -89,3 +89,51 @@ PostconditionException::PostconditionException (const std::string& p_fichier, un
 InvariantException::InvariantException (const std::string& p_fichier, unsigned int p_ligne,
                                         const std::string& p_expression)
 : ContratException (p_fichier, p_ligne, p_expression, "ERREUR D'INVARIANT") { }
+
+
+/**
+ * \brief Lève une AssertionException ; appelée par ASSERTION et AUDIT hors du chemin chaud
+ * \param p_fichier fichier source de l'assertion
+ * \param p_ligne ligne de l'assertion
+ * \param p_expression test logique qui a échoué
+ */
+void contrat::echecAssertion (const char* p_fichier, unsigned int p_ligne, const char* p_expression)
+{
+  throw AssertionException (p_fichier, p_ligne, p_expression);
+}
+
+
+/**
+ * \brief Lève une PreconditionException ; appelée par PRECONDITION hors du chemin chaud
+ * \param p_fichier fichier source de la précondition
+ * \param p_ligne ligne de la précondition
+ * \param p_expression test logique qui a échoué
+ */
+void contrat::echecPrecondition (const char* p_fichier, unsigned int p_ligne, const char* p_expression)
+{
+  throw PreconditionException (p_fichier, p_ligne, p_expression);
+}
+
+
+/**
+ * \brief Lève une PostconditionException ; appelée par POSTCONDITION hors du chemin chaud
+ * \param p_fichier fichier source de la postcondition
+ * \param p_ligne ligne de la postcondition
+ * \param p_expression test logique qui a échoué
+ */
+void contrat::echecPostcondition (const char* p_fichier, unsigned int p_ligne, const char* p_expression)
+{
+  throw PostconditionException (p_fichier, p_ligne, p_expression);
+}
+
+
+/**
+ * \brief Lève une InvariantException ; appelée par INVARIANT et VERIFIER_STRUCTURE hors du chemin chaud
+ * \param p_fichier fichier source de l'invariant
+ * \param p_ligne ligne de l'invariant
+ * \param p_expression test logique qui a échoué
+ */
+void contrat::echecInvariant (const char* p_fichier, unsigned int p_ligne, const char* p_expression)
+{
+  throw InvariantException (p_fichier, p_ligne, p_expression);
+}
@@ -7,7 +7,8 @@
  * la sauvegarde des renseignements de l'erreur.  Cette classe et sa
  * hiérarchie sont intéressantes lors de l'utilisation des exceptions.
  *
- * En release, définir la constante NDEBUG pour désactiver les Macros
+ * En release, définir la constante NDEBUG pour désactiver les Macros, ou
+ * NIVEAU_CONTRAT pour n'en garder qu'une partie (voir plus bas).
  *
  * <pre>
  * Classes:
@@ -105,31 +106,104 @@ public:
 };
 
 
+// --- Niveaux de vérification du contrat
+//
+// NIVEAU_CONTRAT fixe, à la compilation, les macros actives :
+//   0 : aucune (défaut avec NDEBUG)
+//   1 : PRECONDITION seulement, pour une compilation optimisée qui valide
+//       encore les entrées
+//   2 : PRECONDITION, POSTCONDITION, ASSERTION, INVARIANT et INVARIANTS
+//       (défaut sans NDEBUG)
+//   3 : niveau 2, plus les vérifications coûteuses écrites avec AUDIT
+// Le niveau vaut pour tout le programme (option NIVEAU_CONTRAT, voir
+// CMakeLists.txt) : les getters inline de Processus et les gabarits File et
+// TasIndexe portent des contrats, et deux unités de compilation à des niveaux
+// différents en émettraient des définitions différentes (violation de l'ODR).
+
+#ifndef NIVEAU_CONTRAT
+#if defined(NDEBUG)
+#define NIVEAU_CONTRAT 0
+#else
+#define NIVEAU_CONTRAT 2
+#endif
+#endif
+
+// --- Chemin froid
+//
+// Les macros ne contiennent qu'un test et un appel : la construction et la
+// levée de l'exception sont dans des fonctions hors ligne, marquées froides,
+// qui n'empêchent pas l'inlining de l'appelant.
+
+#if defined(__GNUC__) || defined(__clang__)
+#define CONTRAT_FROID __attribute__((cold, noinline))
+#define CONTRAT_PEU_PROBABLE(f) __builtin_expect(!!(f), 0)
+#else
+#define CONTRAT_FROID
+#define CONTRAT_PEU_PROBABLE(f) (f)
+#endif
+
+namespace contrat {
+  [[noreturn]] CONTRAT_FROID void echecAssertion(const char* p_fichier, unsigned int p_ligne, const char* p_expression);
+  [[noreturn]] CONTRAT_FROID void echecPrecondition(const char* p_fichier, unsigned int p_ligne, const char* p_expression);
+  [[noreturn]] CONTRAT_FROID void echecPostcondition(const char* p_fichier, unsigned int p_ligne, const char* p_expression);
+  [[noreturn]] CONTRAT_FROID void echecInvariant(const char* p_fichier, unsigned int p_ligne, const char* p_expression);
+}
+
 // --- Définition des macros de contrôle de la théorie du contrat
 
-#if !defined(NDEBUG)
-// --- Mode debug
+#if NIVEAU_CONTRAT >= 1
+#define PRECONDITION(f)  \
+      if (CONTRAT_PEU_PROBABLE(!(f))) ::contrat::echecPrecondition(__FILE__, __LINE__, #f);
+#else
+#define PRECONDITION(f);
+#endif
 
+#if NIVEAU_CONTRAT >= 2
 #define INVARIANTS() \
       verifieInvariant()
 
 #define ASSERTION(f)     \
-      if (!(f)) throw AssertionException(__FILE__,__LINE__, #f);
-#define PRECONDITION(f)  \
-      if (!(f)) throw PreconditionException(__FILE__, __LINE__, #f);
+      if (CONTRAT_PEU_PROBABLE(!(f))) ::contrat::echecAssertion(__FILE__, __LINE__, #f);
 #define POSTCONDITION(f) \
-      if (!(f)) throw PostconditionException(__FILE__, __LINE__, #f);
+      if (CONTRAT_PEU_PROBABLE(!(f))) ::contrat::echecPostcondition(__FILE__, __LINE__, #f);
 #define INVARIANT(f)   \
-      if (!(f)) throw InvariantException(__FILE__,__LINE__, #f);
-
-// --- LE MODE RELEASE
+      if (CONTRAT_PEU_PROBABLE(!(f))) ::contrat::echecInvariant(__FILE__, __LINE__, #f);
 #else
-
-#define PRECONDITION(f);
 #define POSTCONDITION(f);
 #define INVARIANTS();
 #define INVARIANT(f);
 #define ASSERTION(f);
+#endif
+
+#if NIVEAU_CONTRAT >= 3
+#define AUDIT(f)     \
+      if (CONTRAT_PEU_PROBABLE(!(f))) ::contrat::echecAssertion(__FILE__, __LINE__, #f);
+#else
+#define AUDIT(f);
+#endif
+
+// --- Vérification des structures de données (File, TasIndexe)
+//
+// VERIFICATION_STRUCTURES fixe, à la compilation, ce qui est vérifié après
+// chaque modification d'une structure :
+//   0 : rien (défaut avec NDEBUG)
+//   1 : invariants locaux en O(1)
+//   2 : niveau 1, plus l'invariant complet une fois toutes les taille()
+//       modifications, soit O(1) amorti (défaut sans NDEBUG)
+//   3 : invariant complet après chaque modification, en O(n)
+// Les vérifications actives lèvent InvariantException, même avec NDEBUG : on
+// peut ainsi valider une compilation optimisée sur des données de production.
+// Comme NIVEAU_CONTRAT, ce niveau se fixe pour tout le programme.
+
+#ifndef VERIFICATION_STRUCTURES
+#if defined(NDEBUG)
+#define VERIFICATION_STRUCTURES 0
+#else
+#define VERIFICATION_STRUCTURES 2
+#endif
+#endif
+
+#define VERIFIER_STRUCTURE(f) \
+      if (CONTRAT_PEU_PROBABLE(!(f))) ::contrat::echecInvariant(__FILE__, __LINE__, #f);
 
-#endif  // --- if !defined (NDEBUG)
 #endif  // --- ifndef CONTRATEXCEPTION_H_DEJA_INCLU
\ No newline at end of file
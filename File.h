@@ -6,31 +6,64 @@
 #define FILE_H
 #include <sstream>
 #include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 #include "ContratException.h"
+#include "PoolNoeuds.h"
+
+/**
+ * \brief Mode de stockage par défaut : anneau doublement chaîné autour d'une sentinelle.
+ */
+struct StockageChaine {};
+
+/**
+ * \brief Mode de stockage contigu : tampon circulaire extensible.
+ *
+ *        Voir la spécialisation File<T, StockageContigu> dans FileContigue.h.
+ */
+struct StockageContigu {};
 
 /**
  * \brief Classe générique représentant une file circulaire.
  *
  *        La classe permet d'ajouter, de supprimer et d'accéder à des éléments
- *        de manière ordonnée. Elle gère également les statistiques comme le temps
+ *        de manière ordonnée. En stockage chaîné, les noeuds sont doublement
+ *        chaînés : un itérateur reste une poignée valide tant que son élément
+ *        n'est pas supprimé, et supprimer(iterateur) se fait en O(1). Elle gère également les statistiques comme le temps
  *        d'attente moyen et le nom du test.
  *
  * \tparam T Type des éléments stockés dans la file.
+ * \tparam Stockage Mode de stockage (StockageChaine par défaut, ou StockageContigu).
+ * \tparam Allocateur Politique d'allocation des noeuds (PoolNoeuds par défaut,
+ *         ou AllocateurStandard pour passer par new et delete).
  */
-template <typename T>
+template <typename T, typename Stockage = StockageChaine, typename Allocateur = PoolNoeuds>
 class File {
 public:
   File();
   File(const File& source);
+  File(File&& source) noexcept;
   ~File();
 
+  File& operator=(const File& source);
+  File& operator=(File&& source) noexcept;
+
   void insererDernier(const T& data) ;
+  void insererDernier(T&& data) ;
+  template <typename... Args>
+  void emplaceDernier(Args&&... args) ;
   void inserer(size_t index, T& data) ;
+  template <typename It>
+  void insererPlage(It premier, It fin) ;
 
   void supprimerPremier();
   void supprimer(const T& data);
 
-  T getValeur(size_t index) const;
+  const T& getValeur(size_t index) const;
+  T& getValeur(size_t index);
+  const T& getDernier() const;
   float getTempsMoy() const;
 
   float setTempsMoy(float tempsMoy);
@@ -41,28 +74,109 @@ public:
   bool estVide() const;
   std::string toString() const;
 
+  template <bool Constant>
+  class Iterateur;
+  typedef Iterateur<false> iterator;
+  typedef Iterateur<true> const_iterator;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  iterator supprimer(const_iterator position);
+  void splice(const_iterator position, File& autre);
+  void concatener(File&& autre);
+
 private:
-  struct Node {
+  struct Lien {
+    Lien* next ;
+    Lien* prev ;
+  };
+  struct Node : Lien {
     T valeur ;
-    Node* next ;
-    explicit Node(const T& val) : valeur(val), next(nullptr) {}
+    template <typename... Args>
+    explicit Node(Args&&... args) : Lien{nullptr, nullptr}, valeur(std::forward<Args>(args)...) {}
   };
 
-  Node* dernier ;
+  // Sentinelle de l'anneau : next est le premier noeud, prev le dernier, et
+  // elle pointe sur elle-même quand la file est vide. mutable, car end() const
+  // en fait un itérateur.
+  mutable Lien m_sentinelle ;
   size_t size ;
   float m_tempsMoy ;
   std::string m_NomTest ;
+  // Toujours présent : la disposition de la classe ne dépend pas de VERIFICATION_STRUCTURES.
+  size_t m_modifications ;
+  Node* noeud(size_t index) const ;
+  void lierApres(Node* nouveau, Lien* avant) ;
+  void delier(Node* noeud) ;
+  void verifier() ;
+  bool invariantLocal() const ;
   bool invariant() const ;
 };
 
 
+/**
+ * \brief Itérateur avant sur une file chaînée, du premier au dernier élément.
+ *
+ *        L'itérateur de fin désigne la sentinelle de la file. Un itérateur ne
+ *        dépend que des liens entre noeuds : il reste valide tant que l'élément
+ *        désigné n'est pas supprimé, même après un splice vers une autre file.
+ *
+ * \tparam Constant Vrai pour un accès en lecture seule (const_iterator).
+ */
+template<typename T, typename Stockage, typename Allocateur>
+template<bool Constant>
+class File<T, Stockage, Allocateur>::Iterateur {
+public:
+  typedef std::forward_iterator_tag iterator_category;
+  typedef T value_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef typename std::conditional<Constant, const T*, T*>::type pointer;
+  typedef typename std::conditional<Constant, const T&, T&>::type reference;
+
+  Iterateur() : m_lien(nullptr) {}
+
+  template <bool C, typename = typename std::enable_if<Constant && !C>::type>
+  Iterateur(const Iterateur<C>& autre) : m_lien(autre.m_lien) {}
+
+  reference operator*() const { return static_cast<Node*>(m_lien)->valeur; }
+  pointer operator->() const { return &static_cast<Node*>(m_lien)->valeur; }
+
+  Iterateur& operator++() {
+    m_lien = m_lien->next;
+    return *this;
+  }
+
+  Iterateur operator++(int) {
+    Iterateur copie(*this);
+    ++*this;
+    return copie;
+  }
+
+  bool operator==(const Iterateur& autre) const { return m_lien == autre.m_lien; }
+  bool operator!=(const Iterateur& autre) const { return m_lien != autre.m_lien; }
+
+private:
+  Lien* m_lien;
+
+  explicit Iterateur(Lien* lien) : m_lien(lien) {}
+
+  friend class File;
+  template <bool> friend class Iterateur;
+};
+
+
 /**
  * \brief Constructeur par défaut de la classe File.
  * \post Une file vide est créée avec une taille de 0.
  */
-template<typename T>
-File<T>::File() : dernier(nullptr), size(0), m_tempsMoy(0), m_NomTest("") {
-  assert(invariant());
+template<typename T, typename Stockage, typename Allocateur>
+File<T, Stockage, Allocateur>::File() : m_sentinelle{&m_sentinelle, &m_sentinelle}, size(0), m_tempsMoy(0), m_NomTest(""), m_modifications(0) {
+  verifier();
 }
 
 
@@ -71,47 +185,99 @@ File<T>::File() : dernier(nullptr), size(0), m_tempsMoy(0), m_NomTest("") {
  * \param[in] source La file à copier.
  * \post La nouvelle file contient les mêmes éléments que la source.
  */
-template<typename T>
-File<T>::File(const File &source) : dernier(nullptr), size(0), m_tempsMoy(0), m_NomTest("") {
-  if (source.dernier != nullptr) {
-    auto p = source.dernier;
-    do {
-      p = p->next;
-      insererDernier(p->valeur);
-    }
-    while (p != source.dernier);
+template<typename T, typename Stockage, typename Allocateur>
+File<T, Stockage, Allocateur>::File(const File &source) : m_sentinelle{&m_sentinelle, &m_sentinelle}, size(0), m_tempsMoy(0), m_NomTest(""), m_modifications(0) {
+  for (const T& valeur : source) {
+    insererDernier(valeur);
   }
-  assert(invariant());
+  verifier();
+}
+
+/**
+ * \brief Constructeur de déplacement : reprend les noeuds de la source sans copie.
+ * \param[in] source La file à déplacer.
+ * \post La source est vide ; les itérateurs sur ses éléments désignent ceux de la nouvelle file.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+File<T, Stockage, Allocateur>::File(File &&source) noexcept
+  : m_sentinelle{&m_sentinelle, &m_sentinelle}, size(0), m_tempsMoy(source.m_tempsMoy),
+    m_NomTest(std::move(source.m_NomTest)), m_modifications(0) {
+  splice(cend(), source);
 }
 
 /**
  * \brief Destructeur pour libérer la mémoire utilisée par la file.
  * \post Tous les noeuds de la file sont supprimés.
  */
-template<typename T>
-File<T>::~File() {
+template<typename T, typename Stockage, typename Allocateur>
+File<T, Stockage, Allocateur>::~File() {
   while (!estVide()) supprimerPremier();
 }
 
+/**
+ * \brief Affectation par copie.
+ * \param[in] source La file à copier.
+ * \return La file courante.
+ * \post La file contient les mêmes éléments que la source.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+File<T, Stockage, Allocateur>& File<T, Stockage, Allocateur>::operator=(const File &source) {
+  if (this != &source) {
+    File copie(source);
+    *this = std::move(copie);
+  }
+  return *this;
+}
+
+/**
+ * \brief Affectation par déplacement : reprend les noeuds de la source sans copie.
+ * \param[in] source La file à déplacer.
+ * \return La file courante.
+ * \post La source est vide ; les anciens éléments de la file sont détruits.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+File<T, Stockage, Allocateur>& File<T, Stockage, Allocateur>::operator=(File &&source) noexcept {
+  if (this != &source) {
+    File ancienne(std::move(*this));
+    splice(cend(), source);
+    m_tempsMoy = source.m_tempsMoy;
+    m_NomTest = std::move(source.m_NomTest);
+  }
+  return *this;
+}
+
 /**
  * \brief Insère un élément à la fin de la file.
  * \param[in] data L'élément à insérer.
  * \post L'élément est ajouté à la fin de la file et la taille est incrémentée.
  */
-template<typename T>
-void File<T>::insererDernier(const T &data) {
-  auto nouveau = new Node(data);
-  if (dernier == nullptr) {
-    nouveau->next = nouveau;
-  }
-  else {
-    nouveau->next = dernier->next;
-    dernier->next = nouveau;
-  }
-    dernier = nouveau;
-  size++;
+template<typename T, typename Stockage, typename Allocateur>
+void File<T, Stockage, Allocateur>::insererDernier(const T &data) {
+  emplaceDernier(data);
+}
+
+/**
+ * \brief Insère un élément à la fin de la file en le déplaçant.
+ * \param[in] data L'élément à déplacer dans la file.
+ * \post L'élément est ajouté à la fin de la file et la taille est incrémentée.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+void File<T, Stockage, Allocateur>::insererDernier(T &&data) {
+  emplaceDernier(std::move(data));
+}
 
-  assert(invariant());
+/**
+ * \brief Construit un élément directement à la fin de la file.
+ * \param[in] args Arguments transmis au constructeur de T.
+ * \post L'élément est ajouté à la fin de la file et la taille est incrémentée.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+template<typename... Args>
+void File<T, Stockage, Allocateur>::emplaceDernier(Args&&... args) {
+  auto nouveau = Allocateur::template construire<Node>(std::forward<Args>(args)...);
+  lierApres(nouveau, m_sentinelle.prev);
+
+  verifier();
 }
 
 /**
@@ -121,30 +287,19 @@ void File<T>::insererDernier(const T &data) {
  * \pre index <= taille()
  * \post L'élément est ajouté à l'index spécifié et la taille est incrémentée.
  */
-template<typename T>
-void File<T>::inserer(size_t index, T &data) {
-  PRECONDITION(index >= 0);
+template<typename T, typename Stockage, typename Allocateur>
+void File<T, Stockage, Allocateur>::inserer(size_t index, T &data) {
   assert(index <= size && "Index out of range");
 
-  Node* nouveau = new Node(data);
+  Node* nouveau = Allocateur::template construire<Node>(data);
 
-  if (estVide()) {
-    dernier = nouveau;
-    dernier->next = dernier;
-  } else if (index == 0) {
-    nouveau->next = dernier->next;
-    dernier->next = nouveau;
+  if (estVide() || index == 0) {
+    lierApres(nouveau, &m_sentinelle);
   } else {
-    Node* current = dernier->next;
-    for (size_t i = 0; i < index - 1; ++i) {
-      current = current->next;
-    }
-    nouveau->next = current->next;
-    current->next = nouveau;
+    lierApres(nouveau, noeud(index - 1));
   }
 
-  size++;
-  assert(invariant());
+  verifier();
 }
 
 /**
@@ -152,21 +307,12 @@ void File<T>::inserer(size_t index, T &data) {
  * \pre !estVide()
  * \post Le premier élément est supprimé et la taille est décrémentée.
  */
-template<typename T>
-void File<T>::supprimerPremier() {
+template<typename T, typename Stockage, typename Allocateur>
+void File<T, Stockage, Allocateur>::supprimerPremier() {
   assert(!estVide());
-  if (size == 1) {
-    delete dernier;
-    dernier = nullptr;
-  }
-  else {
-    auto p = dernier->next;
-    dernier->next = p->next;
-    delete p;
-  }
-  --size;
+  delier(static_cast<Node*>(m_sentinelle.next));
 
-  assert(invariant());
+  verifier();
 }
 
 /**
@@ -174,73 +320,178 @@ void File<T>::supprimerPremier() {
  * \param[in] data L'élément à supprimer.
  * \post Si l'élément est trouvé, il est supprimé et la taille est décrémentée.
  */
-template<typename T>
-void File<T>::supprimer(const T &data) {
+template<typename T, typename Stockage, typename Allocateur>
+void File<T, Stockage, Allocateur>::supprimer(const T &data) {
   PRECONDITION(!estVide());
-  if (estVide()) return;
-  Node* curr = dernier->next;
-  Node* prev = dernier;
-
-  if (size == 1 ) {
-    if (curr->valeur == data) {
-      delete curr;
-      dernier = nullptr;
-      --size;
+  for (auto it = cbegin(); it != cend(); ++it) {
+    if (*it == data) {
+      supprimer(it);
       return;
     }
   }
+}
+
+/**
+ * \brief Insère à la fin de la file les éléments d'une plage.
+ * \param[in] premier Début de la plage.
+ * \param[in] fin Fin de la plage (exclue).
+ * \post Les éléments sont ajoutés dans l'ordre de la plage.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+template<typename It>
+void File<T, Stockage, Allocateur>::insererPlage(It premier, It fin) {
+  for (; premier != fin; ++premier) {
+    emplaceDernier(*premier);
+  }
+}
+
+/**
+ * \brief Déplace tous les noeuds d'une autre file devant une position, en O(1).
+ * \param[in] position Itérateur de cette file ; end() pour ajouter à la fin.
+ * \param[in,out] autre La file dont les noeuds sont repris.
+ * \pre &autre != this
+ * \post autre est vide ; ses éléments précèdent position, dans leur ordre.
+ *
+ * Aucun élément n'est copié ni alloué : seuls quatre liens sont modifiés.
+ * Les itérateurs sur les éléments déplacés restent valides et parcourent
+ * désormais cette file jusqu'à son end(). L'itérateur end() de autre reste
+ * celui de autre.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+void File<T, Stockage, Allocateur>::splice(const_iterator position, File &autre) {
+  PRECONDITION(&autre != this);
+  if (autre.estVide()) return;
+
+  Lien* tete = autre.m_sentinelle.next;
+  Lien* queue = autre.m_sentinelle.prev;
+  Lien* apres = position.m_lien;
+  Lien* avant = apres->prev;
+  avant->next = tete;
+  tete->prev = avant;
+  queue->next = apres;
+  apres->prev = queue;
+  size += autre.size;
+
+  autre.m_sentinelle.next = &autre.m_sentinelle;
+  autre.m_sentinelle.prev = &autre.m_sentinelle;
+  autre.size = 0;
+
+  verifier();
+}
 
-  do {
-    if (curr->valeur == data) {
-      prev->next = curr->next;
+/**
+ * \brief Ajoute à la fin de la file tous les éléments d'une autre, en O(1).
+ * \param[in] autre La file à vider dans celle-ci.
+ * \post autre est vide.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+void File<T, Stockage, Allocateur>::concatener(File &&autre) {
+  splice(cend(), autre);
+}
 
-      if (curr == dernier) {
-        dernier = prev;
-      }
+/**
+ * \brief Supprime l'élément désigné par un itérateur, en O(1).
+ * \param[in] position Itérateur valide sur un élément de cette file.
+ * \return Un itérateur sur l'élément qui suivait celui supprimé.
+ * \pre position != end()
+ * \post Seuls les itérateurs sur l'élément supprimé deviennent invalides.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+typename File<T, Stockage, Allocateur>::iterator File<T, Stockage, Allocateur>::supprimer(const_iterator position) {
+  PRECONDITION(position.m_lien != &m_sentinelle);
+  Lien* suivant = position.m_lien->next;
+  delier(static_cast<Node*>(position.m_lien));
+
+  verifier();
+  return iterator(suivant);
+}
 
-      if (curr == dernier->next) {
-        dernier->next = curr->next;
-      }
+/**
+ * \brief Chaîne un nouveau noeud après un noeud existant.
+ * \param[in] nouveau Le noeud à chaîner.
+ * \param[in] avant Le lien qui précédera le nouveau ; la sentinelle pour insérer en tête.
+ * \post La taille est incrémentée.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+void File<T, Stockage, Allocateur>::lierApres(Node* nouveau, Lien* avant) {
+  nouveau->next = avant->next;
+  nouveau->prev = avant;
+  avant->next->prev = nouveau;
+  avant->next = nouveau;
+  size++;
+}
 
-      delete curr;
-      size--;
-      assert(invariant());
-      return;
-    }
-    prev = curr;
-    curr = curr->next;
-  } while (curr != dernier->next);
+/**
+ * \brief Détache un noeud de l'anneau et le rend à l'allocateur.
+ * \param[in] noeud Le noeud à retirer.
+ * \post La taille est décrémentée.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+void File<T, Stockage, Allocateur>::delier(Node* noeud) {
+  noeud->prev->next = noeud->next;
+  noeud->next->prev = noeud->prev;
+  Allocateur::detruire(noeud);
+  --size;
 }
 
 
+/**
+ * \brief Trouve le noeud à un index spécifié.
+ * \param[in] index L'index du noeud.
+ * \return Le noeud à l'index spécifié.
+ * \throw std::out_of_range Si l'index est hors limites.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+typename File<T, Stockage, Allocateur>::Node* File<T, Stockage, Allocateur>::noeud(size_t index) const {
+  if (index >= size) throw std::out_of_range("Index out of range");
+  Lien* current = m_sentinelle.next;
+  for (size_t count = 0; count < index; ++count) {
+    current = current->next;
+  }
+  return static_cast<Node*>(current);
+}
+
 /**
  * \brief Obtient la valeur d'un index spécifié.
  * \param[in] index L'index dont la valeur doit être obtenue.
- * \return La valeur à l'index spécifié.
+ * \return Une référence constante vers la valeur à l'index spécifié.
  * \pre index < taille()
  * \throw std::out_of_range Si l'index est hors limites.
  */
-template<typename T>
-T File<T>::getValeur(size_t index) const {
-  PRECONDITION(index >= 0);
-  Node* current = dernier->next;
-  size_t count = 0;
-  while (current) {
-    if (count == index) {
-      return current->valeur;
-    }
-    current = current->next;
-    count++;
-  }
-  throw std::out_of_range("Index out of range");
+template<typename T, typename Stockage, typename Allocateur>
+const T& File<T, Stockage, Allocateur>::getValeur(size_t index) const {
+  return noeud(index)->valeur;
+}
+
+/**
+ * \brief Obtient la valeur d'un index spécifié, modifiable sur place.
+ * \param[in] index L'index dont la valeur doit être obtenue.
+ * \return Une référence vers la valeur à l'index spécifié.
+ * \pre index < taille()
+ * \throw std::out_of_range Si l'index est hors limites.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+T& File<T, Stockage, Allocateur>::getValeur(size_t index) {
+  return noeud(index)->valeur;
+}
+
+/**
+ * \brief Obtient le dernier élément de la file, en O(1).
+ * \return Une référence constante vers le dernier élément.
+ * \pre !estVide()
+ */
+template<typename T, typename Stockage, typename Allocateur>
+const T& File<T, Stockage, Allocateur>::getDernier() const {
+  PRECONDITION(!estVide());
+  return static_cast<const Node*>(m_sentinelle.prev)->valeur;
 }
 
 /**
  * \brief Obtient le temps d'attente moyen.
  * \return Le temps d'attente moyen actuel.
  */
-template<typename T>
-float File<T>::getTempsMoy() const {
+template<typename T, typename Stockage, typename Allocateur>
+float File<T, Stockage, Allocateur>::getTempsMoy() const {
   return m_tempsMoy;
 }
 
@@ -249,8 +500,8 @@ float File<T>::getTempsMoy() const {
  * \param[in] tempsMoy Le nouveau temps d'attente moyen.
  * \return Le temps d'attente moyen mis à jour.
  */
-template<typename T>
-float File<T>::setTempsMoy(float tempsMoy) {
+template<typename T, typename Stockage, typename Allocateur>
+float File<T, Stockage, Allocateur>::setTempsMoy(float tempsMoy) {
   PRECONDITION(tempsMoy >= 0);
   m_tempsMoy = tempsMoy;
   return m_tempsMoy;
@@ -262,8 +513,8 @@ float File<T>::setTempsMoy(float tempsMoy) {
  * \param[in] nom Le nom du test à définir.
  * \return Le nom du test mis à jour.
  */
-template<typename T>
-std::string File<T>::setNomTest(const std::string &nom) {
+template<typename T, typename Stockage, typename Allocateur>
+std::string File<T, Stockage, Allocateur>::setNomTest(const std::string &nom) {
   PRECONDITION(nom != "");
   m_NomTest = nom;
   return m_NomTest;
@@ -274,8 +525,8 @@ std::string File<T>::setNomTest(const std::string &nom) {
  * \brief Obtient la taille de la file.
  * \return La taille actuelle de la file.
  */
-template<typename T>
-size_t File<T>::taille() const {
+template<typename T, typename Stockage, typename Allocateur>
+size_t File<T, Stockage, Allocateur>::taille() const {
   return size;
 }
 
@@ -283,8 +534,8 @@ size_t File<T>::taille() const {
  * \brief Vérifie si la file est vide.
  * \return Vrai si la file est vide, faux sinon.
  */
-template<typename T>
-bool File<T>::estVide() const {
+template<typename T, typename Stockage, typename Allocateur>
+bool File<T, Stockage, Allocateur>::estVide() const {
   return taille() == 0 ;
 }
 
@@ -293,8 +544,8 @@ bool File<T>::estVide() const {
  * \brief Obtient une représentation en chaîne de la file.
  * \return Une chaîne contenant le contenu de la file.
  */
-template<typename T>
-std::string File<T>::toString() const {
+template<typename T, typename Stockage, typename Allocateur>
+std::string File<T, Stockage, Allocateur>::toString() const {
   std::ostringstream os;
 
   if (m_NomTest != "") {
@@ -302,13 +553,9 @@ std::string File<T>::toString() const {
   }
 
 
-  if (dernier != nullptr) {
-    auto p = dernier ;
-    do {
-      p = p->next ;
-      os << p->valeur ;
-      os << std::endl ;
-    } while (p != dernier) ;
+  for (const T& valeur : *this) {
+    os << valeur ;
+    os << std::endl ;
   }
   if(m_tempsMoy > 0) {
     os << "Temps d'attente moyen : "<< m_tempsMoy << std::endl; ;
@@ -321,20 +568,106 @@ std::string File<T>::toString() const {
 
 }
 
+/**
+ * \brief Itérateur sur le premier élément de la file.
+ * \return begin() == end() si la file est vide.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+typename File<T, Stockage, Allocateur>::iterator File<T, Stockage, Allocateur>::begin() {
+  return iterator(m_sentinelle.next);
+}
+
+/**
+ * \brief Itérateur après le dernier élément de la file.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+typename File<T, Stockage, Allocateur>::iterator File<T, Stockage, Allocateur>::end() {
+  return iterator(&m_sentinelle);
+}
+
+/**
+ * \brief Itérateur constant sur le premier élément de la file.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+typename File<T, Stockage, Allocateur>::const_iterator File<T, Stockage, Allocateur>::begin() const {
+  return const_iterator(m_sentinelle.next);
+}
+
+/**
+ * \brief Itérateur constant après le dernier élément de la file.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+typename File<T, Stockage, Allocateur>::const_iterator File<T, Stockage, Allocateur>::end() const {
+  return const_iterator(&m_sentinelle);
+}
+
+/**
+ * \brief Itérateur constant sur le premier élément de la file.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+typename File<T, Stockage, Allocateur>::const_iterator File<T, Stockage, Allocateur>::cbegin() const {
+  return begin();
+}
+
+/**
+ * \brief Itérateur constant après le dernier élément de la file.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+typename File<T, Stockage, Allocateur>::const_iterator File<T, Stockage, Allocateur>::cend() const {
+  return end();
+}
+
+/**
+ * \brief Vérifie la file après une modification, selon VERIFICATION_STRUCTURES.
+ * \throw InvariantException Si l'invariant vérifié n'est pas respecté.
+ *
+ * Voir ContratException.h pour les niveaux : au niveau 2, l'invariant complet
+ * n'est repris qu'après taille() modifications, ce qui garde un coût O(1) amorti.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+void File<T, Stockage, Allocateur>::verifier() {
+#if VERIFICATION_STRUCTURES >= 3
+  VERIFIER_STRUCTURE(invariant());
+#elif VERIFICATION_STRUCTURES == 2
+  VERIFIER_STRUCTURE(invariantLocal());
+  if (++m_modifications >= size) {
+    m_modifications = 0;
+    VERIFIER_STRUCTURE(invariant());
+  }
+#elif VERIFICATION_STRUCTURES == 1
+  VERIFIER_STRUCTURE(invariantLocal());
+#endif
+}
+
+/**
+ * \brief Vérifie, en O(1), les liens autour de la sentinelle.
+ * \return Vrai si la taille et les voisins de la sentinelle sont cohérents.
+ */
+template<typename T, typename Stockage, typename Allocateur>
+bool File<T, Stockage, Allocateur>::invariantLocal() const {
+  if ((size == 0) != (m_sentinelle.next == &m_sentinelle)) return false;
+  return m_sentinelle.next->prev == &m_sentinelle && m_sentinelle.prev->next == &m_sentinelle;
+}
+
 /**
  * \brief Vérifie l'invariant de la structure de données de la file.
  * \return Vrai si l'invariant est respecté, faux sinon.
  *
  * L'invariant stipule que :
- * - Si la taille de la file est 0, le dernier noeud doit être nul.
- * - Si la taille est supérieure à 0, en parcourant les noeuds à partir du dernier,
- *   on doit revenir au même noeud (c'est-à-dire que la file est circulaire).
+ * - En parcourant taille() noeuds à partir de la sentinelle, on doit revenir
+ *   à la sentinelle (c'est-à-dire que la file est circulaire).
+ * - Chaque lien, sentinelle comprise, est le précédent de son suivant.
  */
-template<typename T>
-bool File<T>::invariant() const {
-  if (size == 0) return (dernier == nullptr);
-  auto p = dernier ;
-  for (size_t i = 0; i < size; ++i) p = p->next ;
-  return (p == dernier);
+template<typename T, typename Stockage, typename Allocateur>
+bool File<T, Stockage, Allocateur>::invariant() const {
+  const Lien* p = &m_sentinelle ;
+  for (size_t i = 0; i <= size; ++i) {
+    if (p->next->prev != p) return false;
+    p = p->next ;
+  }
+  return (p == &m_sentinelle);
 }
+
+#include "FileContigue.h"
+
 #endif //FILE_H
\ No newline at end of file
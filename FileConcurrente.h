@@ -0,0 +1,195 @@
+//
+// Created by Vincent on 10/1/2024.
+//
+
+#ifndef FILECONCURRENTE_H
+#define FILECONCURRENTE_H
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "ContratException.h"
+#include "PoolNoeuds.h"
+
+/**
+ * \brief File sans verrou à producteurs multiples et consommateur unique (MPSC).
+ *
+ *        Reprend l'interface de File : insererDernier() peut être appelée par
+ *        n'importe quel fil, sans verrou (un seul échange atomique) ; premier(),
+ *        supprimerPremier(), extrairePremier() et estVide() sont réservées au fil
+ *        consommateur, typiquement celui de l'ordonnanceur.
+ *
+ *        Algorithme de Vyukov : les producteurs accrochent leur noeud derrière
+ *        m_entree, le consommateur avance m_sortie sur un noeud sentinelle. Un
+ *        élément dont l'insertion n'est pas encore terminée n'est pas visible ;
+ *        estVide() peut donc être vraie brièvement alors que taille() > 0.
+ *
+ * \tparam T Type des éléments stockés dans la file.
+ * \tparam Allocateur Politique d'allocation des noeuds. AllocateurStandard par
+ *         défaut : le consommateur libère des noeuds pris par les producteurs,
+ *         et PoolNoeuds ferait de chaque libération un échange atomique sur la
+ *         pile du producteur, en concurrence avec ses propres allocations.
+ */
+template <typename T, typename Allocateur = AllocateurStandard>
+class FileConcurrente {
+public:
+  FileConcurrente();
+  ~FileConcurrente();
+
+  FileConcurrente(const FileConcurrente&) = delete;
+  FileConcurrente& operator=(const FileConcurrente&) = delete;
+
+  void insererDernier(const T& data) ;
+  void insererDernier(T&& data) ;
+  template <typename... Args>
+  void emplaceDernier(Args&&... args) ;
+
+  T& premier();
+  void supprimerPremier();
+  bool extrairePremier(T& sortie);
+
+  size_t taille() const;
+  bool estVide() const;
+
+private:
+  struct Noeud {
+    std::atomic<Noeud*> next;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type donnees;
+
+    Noeud() : next(nullptr) {}
+    T* valeur() { return reinterpret_cast<T*>(&donnees); }
+  };
+
+  alignas(64) std::atomic<Noeud*> m_entree;
+  alignas(64) Noeud* m_sortie;
+  alignas(64) std::atomic<size_t> m_taille;
+
+  void accrocher(Noeud* noeud);
+};
+
+
+/**
+ * \brief Constructeur : une file vide ne contient que la sentinelle.
+ */
+template<typename T, typename Allocateur>
+FileConcurrente<T, Allocateur>::FileConcurrente() : m_taille(0) {
+  Noeud* sentinelle = Allocateur::template construire<Noeud>();
+  m_entree.store(sentinelle, std::memory_order_relaxed);
+  m_sortie = sentinelle;
+}
+
+/**
+ * \brief Destructeur : détruit les éléments restants.
+ * \pre Aucun producteur n'insère plus dans la file.
+ */
+template<typename T, typename Allocateur>
+FileConcurrente<T, Allocateur>::~FileConcurrente() {
+  while (!estVide()) supprimerPremier();
+  Allocateur::detruire(m_sortie);
+}
+
+/**
+ * \brief Insère un élément à la fin de la file ; sûr depuis n'importe quel fil.
+ * \param[in] data L'élément à insérer.
+ */
+template<typename T, typename Allocateur>
+void FileConcurrente<T, Allocateur>::insererDernier(const T &data) {
+  emplaceDernier(data);
+}
+
+/**
+ * \brief Insère un élément à la fin de la file en le déplaçant ; sûr depuis n'importe quel fil.
+ * \param[in] data L'élément à insérer.
+ */
+template<typename T, typename Allocateur>
+void FileConcurrente<T, Allocateur>::insererDernier(T &&data) {
+  emplaceDernier(std::move(data));
+}
+
+/**
+ * \brief Construit un élément à la fin de la file ; sûr depuis n'importe quel fil.
+ * \param[in] args Arguments transmis au constructeur de T.
+ */
+template<typename T, typename Allocateur>
+template<typename... Args>
+void FileConcurrente<T, Allocateur>::emplaceDernier(Args&&... args) {
+  Noeud* noeud = Allocateur::template construire<Noeud>();
+  try {
+    new (noeud->valeur()) T(std::forward<Args>(args)...);
+  } catch (...) {
+    Allocateur::detruire(noeud);
+    throw;
+  }
+  accrocher(noeud);
+}
+
+/**
+ * \brief Publie un noeud : un échange atomique, puis le chaînage depuis le précédent.
+ */
+template<typename T, typename Allocateur>
+void FileConcurrente<T, Allocateur>::accrocher(Noeud* noeud) {
+  m_taille.fetch_add(1, std::memory_order_relaxed);
+  Noeud* precedent = m_entree.exchange(noeud, std::memory_order_acq_rel);
+  precedent->next.store(noeud, std::memory_order_release);
+}
+
+/**
+ * \brief Accède au premier élément ; réservé au consommateur.
+ * \return Une référence vers le premier élément.
+ * \pre !estVide()
+ */
+template<typename T, typename Allocateur>
+T& FileConcurrente<T, Allocateur>::premier() {
+  Noeud* suivant = m_sortie->next.load(std::memory_order_acquire);
+  PRECONDITION(suivant != nullptr);
+  return *suivant->valeur();
+}
+
+/**
+ * \brief Supprime le premier élément ; réservé au consommateur.
+ * \pre !estVide()
+ * \post Le noeud du premier élément devient la nouvelle sentinelle.
+ */
+template<typename T, typename Allocateur>
+void FileConcurrente<T, Allocateur>::supprimerPremier() {
+  Noeud* suivant = m_sortie->next.load(std::memory_order_acquire);
+  PRECONDITION(suivant != nullptr);
+  suivant->valeur()->~T();
+  Allocateur::detruire(m_sortie);
+  m_sortie = suivant;
+  m_taille.fetch_sub(1, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Retire le premier élément s'il y en a un ; réservé au consommateur.
+ * \param[out] sortie Reçoit le premier élément, par déplacement.
+ * \return Vrai si un élément a été retiré, faux si la file paraissait vide.
+ */
+template<typename T, typename Allocateur>
+bool FileConcurrente<T, Allocateur>::extrairePremier(T &sortie) {
+  Noeud* suivant = m_sortie->next.load(std::memory_order_acquire);
+  if (suivant == nullptr) return false;
+  sortie = std::move(*suivant->valeur());
+  supprimerPremier();
+  return true;
+}
+
+/**
+ * \brief Nombre d'éléments insérés et pas encore supprimés (approximatif en concurrence).
+ */
+template<typename T, typename Allocateur>
+size_t FileConcurrente<T, Allocateur>::taille() const {
+  return m_taille.load(std::memory_order_relaxed);
+}
+
+/**
+ * \brief Vérifie si un élément est prêt à être consommé ; réservé au consommateur.
+ */
+template<typename T, typename Allocateur>
+bool FileConcurrente<T, Allocateur>::estVide() const {
+  return m_sortie->next.load(std::memory_order_acquire) == nullptr;
+}
+
+#endif //FILECONCURRENTE_H
@@ -0,0 +1,647 @@
+//
+// Created by Vincent on 10/1/2024.
+//
+
+#ifndef FILECONTIGUE_H
+#define FILECONTIGUE_H
+#include "File.h"
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \brief Spécialisation de File sur un tampon circulaire contigu.
+ *
+ *        Même interface publique que la file chaînée, mais les éléments sont
+ *        rangés dans un tableau dont la capacité (puissance de deux) double au
+ *        besoin. L'accès indexé getValeur() est en O(1), insererDernier() et
+ *        supprimerPremier() en O(1) amorti. Les insertions et suppressions au
+ *        milieu déplacent le plus petit des deux côtés du tampon.
+ *
+ * \tparam T Type des éléments stockés dans la file.
+ * \tparam Allocateur Sans effet ici : le tampon n'alloue pas de noeuds.
+ */
+template <typename T, typename Allocateur>
+class File<T, StockageContigu, Allocateur> {
+public:
+  File();
+  File(const File& source);
+  File(File&& source) noexcept;
+  template <typename S, typename A>
+  explicit File(const File<T, S, A>& source);
+  ~File();
+
+  File& operator=(const File& source);
+  File& operator=(File&& source) noexcept;
+
+  void insererDernier(const T& data) ;
+  void insererDernier(T&& data) ;
+  template <typename... Args>
+  void emplaceDernier(Args&&... args) ;
+  void inserer(size_t index, T& data) ;
+  template <typename It>
+  void insererPlage(It premier, It fin) ;
+
+  void supprimerPremier();
+  void supprimer(const T& data);
+
+  const T& getValeur(size_t index) const;
+  T& getValeur(size_t index);
+  const T& getDernier() const;
+  float getTempsMoy() const;
+
+  float setTempsMoy(float tempsMoy);
+  std::string setNomTest(const std::string& nom);
+
+
+  size_t taille() const;
+  bool estVide() const;
+  std::string toString() const;
+
+  template <bool Constant>
+  class Iterateur;
+  typedef Iterateur<false> iterator;
+  typedef Iterateur<true> const_iterator;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  iterator supprimer(const_iterator position);
+  void splice(const_iterator position, File& autre);
+  void concatener(File&& autre);
+
+private:
+  T* m_tampon ;
+  size_t m_capacite ;
+  size_t m_tete ;
+  size_t size ;
+  float m_tempsMoy ;
+  std::string m_NomTest ;
+
+  T* case_(size_t index) const ;
+  void reserver(size_t capacite) ;
+  void retirerA(size_t index) ;
+  void verifier() const ;
+  bool invariant() const ;
+};
+
+
+/**
+ * \brief Itérateur avant sur une file contiguë : une position logique dans le tampon.
+ *
+ * \tparam Constant Vrai pour un accès en lecture seule (const_iterator).
+ */
+template<typename T, typename Allocateur>
+template<bool Constant>
+class File<T, StockageContigu, Allocateur>::Iterateur {
+public:
+  typedef std::forward_iterator_tag iterator_category;
+  typedef T value_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef typename std::conditional<Constant, const T*, T*>::type pointer;
+  typedef typename std::conditional<Constant, const T&, T&>::type reference;
+
+  Iterateur() : m_file(nullptr), m_index(0) {}
+
+  template <bool C, typename = typename std::enable_if<Constant && !C>::type>
+  Iterateur(const Iterateur<C>& autre) : m_file(autre.m_file), m_index(autre.m_index) {}
+
+  reference operator*() const { return *m_file->case_(m_index); }
+  pointer operator->() const { return m_file->case_(m_index); }
+
+  Iterateur& operator++() {
+    ++m_index;
+    return *this;
+  }
+
+  Iterateur operator++(int) {
+    Iterateur copie(*this);
+    ++m_index;
+    return copie;
+  }
+
+  bool operator==(const Iterateur& autre) const { return m_index == autre.m_index; }
+  bool operator!=(const Iterateur& autre) const { return m_index != autre.m_index; }
+
+private:
+  const File* m_file;
+  size_t m_index;
+
+  Iterateur(const File* file, size_t index) : m_file(file), m_index(index) {}
+
+  friend class File;
+  template <bool> friend class Iterateur;
+};
+
+
+/**
+ * \brief Constructeur par défaut de la file contiguë.
+ * \post Une file vide est créée, sans tampon alloué.
+ */
+template<typename T, typename Allocateur>
+File<T, StockageContigu, Allocateur>::File() : m_tampon(nullptr), m_capacite(0), m_tete(0), size(0),
+                                               m_tempsMoy(0), m_NomTest("") {
+  verifier();
+}
+
+/**
+ * \brief Constructeur de copie.
+ * \param[in] source La file à copier.
+ * \post La nouvelle file contient les mêmes éléments que la source, dans le même ordre.
+ */
+template<typename T, typename Allocateur>
+File<T, StockageContigu, Allocateur>::File(const File &source) : File() {
+  reserver(source.size);
+  for (const T& valeur : source) {
+    insererDernier(valeur);
+  }
+  verifier();
+}
+
+/**
+ * \brief Constructeur de déplacement : reprend le tampon de la source.
+ * \param[in] source La file à déplacer.
+ * \post La source est vide et sans tampon.
+ */
+template<typename T, typename Allocateur>
+File<T, StockageContigu, Allocateur>::File(File &&source) noexcept : File() {
+  *this = std::move(source);
+}
+
+/**
+ * \brief Construit une file contiguë à partir d'une file chaînée.
+ * \param[in] source La file à copier.
+ * \post La nouvelle file contient les mêmes éléments que la source, dans le même ordre.
+ */
+template<typename T, typename Allocateur>
+template<typename S, typename A>
+File<T, StockageContigu, Allocateur>::File(const File<T, S, A> &source) : File() {
+  reserver(source.taille());
+  for (const T& valeur : source) {
+    insererDernier(valeur);
+  }
+  verifier();
+}
+
+/**
+ * \brief Destructeur : détruit les éléments et libère le tampon.
+ */
+template<typename T, typename Allocateur>
+File<T, StockageContigu, Allocateur>::~File() {
+  while (!estVide()) supprimerPremier();
+  ::operator delete(m_tampon);
+}
+
+/**
+ * \brief Affectation par copie.
+ * \param[in] source La file à copier.
+ * \return La file courante.
+ * \post La file contient les mêmes éléments que la source.
+ */
+template<typename T, typename Allocateur>
+File<T, StockageContigu, Allocateur>& File<T, StockageContigu, Allocateur>::operator=(const File &source) {
+  if (this != &source) {
+    File copie(source);
+    *this = std::move(copie);
+  }
+  return *this;
+}
+
+/**
+ * \brief Affectation par déplacement : échange les tampons avec la source.
+ * \param[in] source La file à déplacer.
+ * \return La file courante.
+ */
+template<typename T, typename Allocateur>
+File<T, StockageContigu, Allocateur>& File<T, StockageContigu, Allocateur>::operator=(File &&source) noexcept {
+  std::swap(m_tampon, source.m_tampon);
+  std::swap(m_capacite, source.m_capacite);
+  std::swap(m_tete, source.m_tete);
+  std::swap(size, source.size);
+  std::swap(m_tempsMoy, source.m_tempsMoy);
+  std::swap(m_NomTest, source.m_NomTest);
+  return *this;
+}
+
+/**
+ * \brief Donne l'adresse de la case logique index.
+ * \param[in] index Position logique à partir de la tête.
+ * \return Pointeur vers l'élément.
+ */
+template<typename T, typename Allocateur>
+T* File<T, StockageContigu, Allocateur>::case_(size_t index) const {
+  return m_tampon + ((m_tete + index) & (m_capacite - 1));
+}
+
+/**
+ * \brief Agrandit le tampon pour contenir au moins capacite éléments.
+ * \param[in] capacite Capacité minimale voulue.
+ * \post Les éléments sont déplacés au début du nouveau tampon (m_tete == 0).
+ */
+template<typename T, typename Allocateur>
+void File<T, StockageContigu, Allocateur>::reserver(size_t capacite) {
+  if (capacite <= m_capacite) return;
+  size_t nouvelle = m_capacite == 0 ? 8 : m_capacite;
+  while (nouvelle < capacite) nouvelle *= 2;
+
+  T* tampon = static_cast<T*>(::operator new(nouvelle * sizeof(T)));
+  for (size_t i = 0; i < size; ++i) {
+    T* p = case_(i);
+    new (tampon + i) T(std::move(*p));
+    p->~T();
+  }
+  ::operator delete(m_tampon);
+  m_tampon = tampon;
+  m_capacite = nouvelle;
+  m_tete = 0;
+}
+
+/**
+ * \brief Insère un élément à la fin de la file.
+ * \param[in] data L'élément à insérer.
+ * \post L'élément est ajouté à la fin de la file et la taille est incrémentée.
+ */
+template<typename T, typename Allocateur>
+void File<T, StockageContigu, Allocateur>::insererDernier(const T &data) {
+  emplaceDernier(data);
+}
+
+/**
+ * \brief Insère un élément à la fin de la file en le déplaçant.
+ * \param[in] data L'élément à déplacer dans la file.
+ * \post L'élément est ajouté à la fin de la file et la taille est incrémentée.
+ */
+template<typename T, typename Allocateur>
+void File<T, StockageContigu, Allocateur>::insererDernier(T &&data) {
+  emplaceDernier(std::move(data));
+}
+
+/**
+ * \brief Construit un élément directement à la fin de la file.
+ * \param[in] args Arguments transmis au constructeur de T.
+ * \post L'élément est ajouté à la fin de la file et la taille est incrémentée.
+ *
+ * Si le tampon est plein, l'élément est d'abord construit à part : les arguments
+ * peuvent ainsi désigner un élément de la file elle-même.
+ */
+template<typename T, typename Allocateur>
+template<typename... Args>
+void File<T, StockageContigu, Allocateur>::emplaceDernier(Args&&... args) {
+  if (size == m_capacite) {
+    T nouveau(std::forward<Args>(args)...);
+    reserver(size + 1);
+    new (case_(size)) T(std::move(nouveau));
+  }
+  else {
+    new (case_(size)) T(std::forward<Args>(args)...);
+  }
+  size++;
+
+  verifier();
+}
+
+/**
+ * \brief Insère un élément à un index spécifié dans la file.
+ * \param[in] index L'index où l'élément doit être inséré.
+ * \param[in] data L'élément à insérer.
+ * \pre index <= taille()
+ * \post L'élément est ajouté à l'index spécifié et la taille est incrémentée.
+ */
+template<typename T, typename Allocateur>
+void File<T, StockageContigu, Allocateur>::inserer(size_t index, T &data) {
+  assert(index <= size && "Index out of range");
+
+  insererDernier(data);
+  for (size_t i = size - 1; i > index; --i) {
+    std::swap(*case_(i), *case_(i - 1));
+  }
+
+  verifier();
+}
+
+/**
+ * \brief Supprime le premier élément de la file.
+ * \pre !estVide()
+ * \post Le premier élément est supprimé et la taille est décrémentée.
+ */
+template<typename T, typename Allocateur>
+void File<T, StockageContigu, Allocateur>::supprimerPremier() {
+  assert(!estVide());
+  case_(0)->~T();
+  m_tete = (m_tete + 1) & (m_capacite - 1);
+  --size;
+
+  verifier();
+}
+
+/**
+ * \brief Retire l'élément à la position index en décalant le côté le plus court.
+ * \param[in] index Position de l'élément à retirer.
+ * \pre index < taille()
+ */
+template<typename T, typename Allocateur>
+void File<T, StockageContigu, Allocateur>::retirerA(size_t index) {
+  if (index < size / 2) {
+    for (size_t i = index; i > 0; --i) {
+      *case_(i) = std::move(*case_(i - 1));
+    }
+    supprimerPremier();
+  }
+  else {
+    for (size_t i = index; i + 1 < size; ++i) {
+      *case_(i) = std::move(*case_(i + 1));
+    }
+    case_(size - 1)->~T();
+    --size;
+  }
+}
+
+/**
+ * \brief Supprime un élément spécifique de la file.
+ * \param[in] data L'élément à supprimer.
+ * \post Si l'élément est trouvé, il est supprimé et la taille est décrémentée.
+ */
+template<typename T, typename Allocateur>
+void File<T, StockageContigu, Allocateur>::supprimer(const T &data) {
+  PRECONDITION(!estVide());
+  for (size_t i = 0; i < size; ++i) {
+    if (*case_(i) == data) {
+      retirerA(i);
+      verifier();
+      return;
+    }
+  }
+}
+
+/**
+ * \brief Insère à la fin de la file les éléments d'une plage.
+ * \param[in] premier Début de la plage.
+ * \param[in] fin Fin de la plage (exclue).
+ * \post Les éléments sont ajoutés dans l'ordre de la plage.
+ */
+template<typename T, typename Allocateur>
+template<typename It>
+void File<T, StockageContigu, Allocateur>::insererPlage(It premier, It fin) {
+  for (; premier != fin; ++premier) {
+    emplaceDernier(*premier);
+  }
+}
+
+/**
+ * \brief Déplace tous les éléments d'une autre file devant une position.
+ * \param[in] position Itérateur de cette file ; end() pour ajouter à la fin.
+ * \param[in,out] autre La file à vider dans celle-ci.
+ * \pre &autre != this
+ * \post autre est vide ; ses éléments précèdent position, dans leur ordre.
+ *
+ * Les éléments sont déplacés un à un : O(taille() + autre.taille()). Si cette
+ * file est vide, les tampons sont simplement échangés.
+ */
+template<typename T, typename Allocateur>
+void File<T, StockageContigu, Allocateur>::splice(const_iterator position, File &autre) {
+  PRECONDITION(&autre != this);
+  if (estVide()) {
+    std::swap(m_tampon, autre.m_tampon);
+    std::swap(m_capacite, autre.m_capacite);
+    std::swap(m_tete, autre.m_tete);
+    std::swap(size, autre.size);
+    return;
+  }
+
+  size_t index = position.m_index;
+  size_t ancienneTaille = size;
+  reserver(size + autre.size);
+  for (T& valeur : autre) {
+    emplaceDernier(std::move(valeur));
+  }
+  while (!autre.estVide()) autre.supprimerPremier();
+  std::rotate(iterator(this, index), iterator(this, ancienneTaille), end());
+
+  verifier();
+}
+
+/**
+ * \brief Ajoute à la fin de la file tous les éléments d'une autre.
+ * \param[in] autre La file à vider dans celle-ci.
+ * \post autre est vide.
+ */
+template<typename T, typename Allocateur>
+void File<T, StockageContigu, Allocateur>::concatener(File &&autre) {
+  splice(cend(), autre);
+}
+
+/**
+ * \brief Supprime l'élément désigné par un itérateur.
+ * \param[in] position Itérateur valide sur un élément de cette file.
+ * \return Un itérateur sur l'élément qui suivait celui supprimé.
+ * \pre position != end()
+ *
+ * Linéaire dans le pire cas : le plus petit côté du tampon est décalé, ce qui
+ * invalide les autres itérateurs. Préférer la file chaînée pour des poignées stables.
+ */
+template<typename T, typename Allocateur>
+typename File<T, StockageContigu, Allocateur>::iterator File<T, StockageContigu, Allocateur>::supprimer(const_iterator position) {
+  PRECONDITION(position.m_index < size);
+  retirerA(position.m_index);
+
+  verifier();
+  return iterator(this, position.m_index);
+}
+
+/**
+ * \brief Obtient la valeur d'un index spécifié, en O(1).
+ * \param[in] index L'index dont la valeur doit être obtenue.
+ * \return Une référence constante vers la valeur à l'index spécifié.
+ * \pre index < taille()
+ * \throw std::out_of_range Si l'index est hors limites.
+ */
+template<typename T, typename Allocateur>
+const T& File<T, StockageContigu, Allocateur>::getValeur(size_t index) const {
+  if (index >= size) throw std::out_of_range("Index out of range");
+  return *case_(index);
+}
+
+/**
+ * \brief Obtient la valeur d'un index spécifié, modifiable sur place, en O(1).
+ * \param[in] index L'index dont la valeur doit être obtenue.
+ * \return Une référence vers la valeur à l'index spécifié.
+ * \pre index < taille()
+ * \throw std::out_of_range Si l'index est hors limites.
+ */
+template<typename T, typename Allocateur>
+T& File<T, StockageContigu, Allocateur>::getValeur(size_t index) {
+  if (index >= size) throw std::out_of_range("Index out of range");
+  return *case_(index);
+}
+
+/**
+ * \brief Obtient le dernier élément de la file, en O(1).
+ * \return Une référence constante vers le dernier élément.
+ * \pre !estVide()
+ */
+template<typename T, typename Allocateur>
+const T& File<T, StockageContigu, Allocateur>::getDernier() const {
+  PRECONDITION(!estVide());
+  return *case_(size - 1);
+}
+
+/**
+ * \brief Obtient le temps d'attente moyen.
+ * \return Le temps d'attente moyen actuel.
+ */
+template<typename T, typename Allocateur>
+float File<T, StockageContigu, Allocateur>::getTempsMoy() const {
+  return m_tempsMoy;
+}
+
+/**
+ * \brief Définit le temps d'attente moyen.
+ * \param[in] tempsMoy Le nouveau temps d'attente moyen.
+ * \return Le temps d'attente moyen mis à jour.
+ */
+template<typename T, typename Allocateur>
+float File<T, StockageContigu, Allocateur>::setTempsMoy(float tempsMoy) {
+  PRECONDITION(tempsMoy >= 0);
+  m_tempsMoy = tempsMoy;
+  return m_tempsMoy;
+}
+
+/**
+ * \brief Définit le nom du test.
+ * \param[in] nom Le nom du test à définir.
+ * \return Le nom du test mis à jour.
+ */
+template<typename T, typename Allocateur>
+std::string File<T, StockageContigu, Allocateur>::setNomTest(const std::string &nom) {
+  PRECONDITION(nom != "");
+  m_NomTest = nom;
+  return m_NomTest;
+}
+
+/**
+ * \brief Obtient la taille de la file.
+ * \return La taille actuelle de la file.
+ */
+template<typename T, typename Allocateur>
+size_t File<T, StockageContigu, Allocateur>::taille() const {
+  return size;
+}
+
+/**
+ * \brief Vérifie si la file est vide.
+ * \return Vrai si la file est vide, faux sinon.
+ */
+template<typename T, typename Allocateur>
+bool File<T, StockageContigu, Allocateur>::estVide() const {
+  return taille() == 0 ;
+}
+
+/**
+ * \brief Obtient une représentation en chaîne de la file.
+ * \return Une chaîne contenant le contenu de la file.
+ */
+template<typename T, typename Allocateur>
+std::string File<T, StockageContigu, Allocateur>::toString() const {
+  std::ostringstream os;
+
+  if (m_NomTest != "") {
+    os << "simulation de " << m_NomTest <<  " Resultat:" << std::endl;
+  }
+
+  for (const T& valeur : *this) {
+    os << valeur ;
+    os << std::endl ;
+  }
+  if(m_tempsMoy > 0) {
+    os << "Temps d'attente moyen : "<< m_tempsMoy << std::endl; ;
+  }else {
+    os << "fin chargement" << std::endl;
+  }
+
+  return os.str();
+}
+
+/**
+ * \brief Itérateur sur le premier élément de la file.
+ * \return begin() == end() si la file est vide.
+ */
+template<typename T, typename Allocateur>
+typename File<T, StockageContigu, Allocateur>::iterator File<T, StockageContigu, Allocateur>::begin() {
+  return iterator(this, 0);
+}
+
+/**
+ * \brief Itérateur après le dernier élément de la file.
+ */
+template<typename T, typename Allocateur>
+typename File<T, StockageContigu, Allocateur>::iterator File<T, StockageContigu, Allocateur>::end() {
+  return iterator(this, size);
+}
+
+/**
+ * \brief Itérateur constant sur le premier élément de la file.
+ */
+template<typename T, typename Allocateur>
+typename File<T, StockageContigu, Allocateur>::const_iterator File<T, StockageContigu, Allocateur>::begin() const {
+  return const_iterator(this, 0);
+}
+
+/**
+ * \brief Itérateur constant après le dernier élément de la file.
+ */
+template<typename T, typename Allocateur>
+typename File<T, StockageContigu, Allocateur>::const_iterator File<T, StockageContigu, Allocateur>::end() const {
+  return const_iterator(this, size);
+}
+
+/**
+ * \brief Itérateur constant sur le premier élément de la file.
+ */
+template<typename T, typename Allocateur>
+typename File<T, StockageContigu, Allocateur>::const_iterator File<T, StockageContigu, Allocateur>::cbegin() const {
+  return begin();
+}
+
+/**
+ * \brief Itérateur constant après le dernier élément de la file.
+ */
+template<typename T, typename Allocateur>
+typename File<T, StockageContigu, Allocateur>::const_iterator File<T, StockageContigu, Allocateur>::cend() const {
+  return end();
+}
+
+/**
+ * \brief Vérifie le tampon après une modification, selon VERIFICATION_STRUCTURES.
+ * \throw InvariantException Si l'invariant n'est pas respecté.
+ *
+ * L'invariant du tampon est en O(1) : il est vérifié dès le niveau 1.
+ */
+template<typename T, typename Allocateur>
+void File<T, StockageContigu, Allocateur>::verifier() const {
+#if VERIFICATION_STRUCTURES >= 1
+  VERIFIER_STRUCTURE(invariant());
+#endif
+}
+
+/**
+ * \brief Vérifie l'invariant du tampon circulaire.
+ * \return Vrai si l'invariant est respecté, faux sinon.
+ *
+ * L'invariant stipule que :
+ * - La capacité est nulle (aucun tampon) ou une puissance de deux.
+ * - La taille ne dépasse pas la capacité et la tête est dans le tampon.
+ */
+template<typename T, typename Allocateur>
+bool File<T, StockageContigu, Allocateur>::invariant() const {
+  if (m_capacite == 0) return m_tampon == nullptr && size == 0 && m_tete == 0;
+  return (m_capacite & (m_capacite - 1)) == 0 && size <= m_capacite && m_tete < m_capacite;
+}
+
+#endif //FILECONTIGUE_H
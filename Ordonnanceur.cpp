@@ -1,8 +1,29 @@
 #include "Ordonnanceur.h"
 #include "File.h"
 #include "Processus.h"
-#include <limits>
+#include <string>
+#include <vector>
 #include "ContratException.h"
+#include "Politiques.h"
+#include "Simulation.h"
+
+namespace {
+    /**
+     * \brief Matérialise le résultat d'une simulation sur table en File<Processus>.
+     *
+     * \param table La table simulée.
+     * \param ordre Les indices des processus dans l'ordre où ils se terminent.
+     * \param nom Le nom de la simulation, ou "" pour ne pas en afficher.
+     * \return La file de processus ordonnancés avec les temps d'attente et de fin calculés.
+     */
+    File<Processus> resultat(const TableProcessus& table, const std::vector<uint32_t>& ordre, const std::string& nom) {
+        File<Processus> result = table.versFile(ordre);
+        if (nom != "") {
+            result.setNomTest(nom);
+        }
+        return result;
+    }
+}
 
 namespace TP {
     /**
@@ -16,43 +37,8 @@ namespace TP {
      * \return La file de processus ordonnancés avec les temps d'attente et de fin calculés.
      */
     File<Processus> fcfs(const File<Processus>& f_entree, const int &temps) {
-        PRECONDITION(temps >= 0);
-        File<Processus> result;
-        File<Processus> travail(f_entree);
-        int Attente = 0;
-        int clock = temps;
-
-        result.setNomTest("FCFS");
-
-        while (!travail.estVide()) {
-            int minIndex = -1;
-            int minArrivee = std::numeric_limits<int>::max();
-
-            for (int i = 0; i < travail.taille(); i++) {
-                Processus curr = travail.getValeur(i);
-
-                if (curr.getArrivee() < minArrivee) {
-                    minArrivee = curr.getArrivee();
-                    minIndex = i;
-                }
-            }
-            Processus pris = travail.getValeur(minIndex);
-
-            travail.supprimer(pris);
-            pris.setAttente(clock-pris.getArrivee());
-            clock += pris.getDuree();
-            pris.setFin(clock);
-            result.insererDernier(pris);
-        }
-
-        for (int i = 0; i < result.taille(); i++) {
-            Processus copie = result.getValeur(i);
-            Attente += static_cast<float>(copie.getAttente());
-        }
-        float moyenneTemps = (Attente) / static_cast<float>(result.taille());
-        result.setTempsMoy(moyenneTemps);
-
-        return result;
+        TableProcessus table(f_entree);
+        return resultat(table, fcfs(table, temps), "FCFS");
     }
 
     /**
@@ -66,50 +52,24 @@ namespace TP {
      * \return La file de processus ordonnancés avec les temps d'attente et de fin calculés.
      */
     File<Processus> fjs(const File<Processus>& f_entree, const int &temps) {
-        PRECONDITION(temps >= 0);
-        File<Processus> result;
-        File<Processus> travail(f_entree);
-        int Attente = 0;
-        int clock = temps;
-
-        result.setNomTest("FJS");
-
-        while (!travail.estVide()) {
-            int minIndex = -1;
-            int minArrivee = std::numeric_limits<int>::max();
-            int minDuree = std::numeric_limits<int>::max();
-
-            for (int i = 0; i < travail.taille(); i++) {
-                Processus curr = travail.getValeur(i);
-
-                if (curr.getArrivee() < minArrivee) {
-                    minArrivee = curr.getArrivee();
-                    minDuree = curr.getDuree();
-                    minIndex = i;
-                }else if(curr.getArrivee() == minArrivee) {
-                    if (curr.getDuree() < minDuree) {
-                        minDuree = curr.getDuree();
-                        minIndex = i;
-                    }
-                }
-            }
-            Processus pris = travail.getValeur(minIndex);
-
-            travail.supprimer(pris);
-            pris.setAttente(clock-pris.getArrivee());
-            clock += pris.getDuree();
-            pris.setFin(clock);
-            result.insererDernier(pris);
-        }
-
-        for (int i = 0; i < result.taille(); i++) {
-            Processus copie = result.getValeur(i);
-            Attente += static_cast<float>(copie.getAttente());
-        }
-        float moyenneTemps = (Attente) / static_cast<float>(result.taille());
-        result.setTempsMoy(moyenneTemps);
+        TableProcessus table(f_entree);
+        return resultat(table, fjs(table, temps), "FJS");
+    }
 
-        return result;
+    /**
+     * \brief Algorithme SRTF (Shortest Remaining Time First).
+     *
+     *        Version préemptive de FJS : à chaque arrivée, le processus dont le
+     *        temps restant est le plus court prend le processeur. Donne le temps
+     *        d'attente moyen minimal, à utiliser comme borne inférieure.
+     *
+     * \param f_entree La file de processus d'entrée.
+     * \param temps Le temps de décalage.
+     * \return La file de processus ordonnancés avec les temps d'attente et de fin calculés.
+     */
+    File<Processus> srtf(const File<Processus>& f_entree, const int &temps) {
+        TableProcessus table(f_entree);
+        return resultat(table, srtf(table, temps), "SRTF");
     }
 
     /**
@@ -124,117 +84,8 @@ namespace TP {
      * \return La file de processus ordonnancés avec les temps d'attente et de fin calculés.
      */
     File<Processus> round_robin(const File<Processus>& f_entree,const int& f_quantum, const int &temps) {
-        PRECONDITION(temps >= 0);
-        PRECONDITION(f_quantum >= 0);
-        File<Processus> result;
-        File<Processus> travail(f_entree);
-        File<Processus> copie(f_entree);
-        File<Processus> temp;
-
-        int quantum = f_quantum;
-        int Clock = 0;
-        float Attente = 0;
-
-        result.setNomTest("Round Robin");
-
-        while (!travail.estVide()) {
-            int minIndex = -1;
-            int minArrivee = std::numeric_limits<int>::max();
-
-            for (int i = 0; i < travail.taille(); i++) {
-                Processus curr = travail.getValeur(i);
-
-                if (curr.getArrivee() < minArrivee) {
-                    minArrivee = curr.getArrivee();
-                    minIndex = i;
-                }
-            }
-
-            Processus t_pris = travail.getValeur(minIndex);
-            Processus C_pris = copie.getValeur(minIndex);
-
-            travail.supprimer(t_pris);
-
-            if (t_pris.getDuree() <= quantum) {
-                int t_temps = t_pris.getDuree();
-
-                while (travail.taille() > 0) {
-                    Processus Autre = travail.getValeur(0);
-
-                    if (Autre.getArrivee() <= Clock) {
-                        travail.supprimer(Autre);
-                        Autre.incAttente(t_temps);
-                        temp.insererDernier(Autre);
-                    }else if (Autre.getArrivee() > Clock && Autre.getArrivee() <= Clock + t_temps) {
-                        int partialWait = (Clock + t_temps) - Autre.getArrivee();
-                        travail.supprimer(Autre);
-                        Autre.incAttente(partialWait);
-                        temp.insererDernier(Autre);
-                    }else {
-                        travail.supprimer(Autre);
-                        temp.insererDernier(Autre);
-                    }
-                }
-
-                while (temp.taille() > 0) {
-                    Processus retour = temp.getValeur(0);
-                    temp.supprimerPremier();
-                    travail.insererDernier(retour);
-                }
-
-                C_pris.setAttente(t_pris.getAttente());
-                C_pris.incAttente(temps);
-                Clock += t_temps;
-                C_pris.setFin(Clock+temps);
-                copie.supprimer(C_pris);
-                result.insererDernier(C_pris);
-
-            }
-
-            else if (t_pris.getDuree() > quantum) {
-                int t_temps = quantum;
-
-                while (travail.taille() > 0) {
-                    Processus Autre = travail.getValeur(0);
-
-                    if (Autre.getArrivee() > Clock && Autre.getArrivee() <= Clock + t_temps) {
-                        int partialWait = (Clock + t_temps) - Autre.getArrivee();
-
-                        travail.supprimer(Autre);
-                        Autre.incAttente(partialWait);
-                        temp.insererDernier(Autre);
-                    }else if (Autre.getArrivee() <= Clock) {
-                        travail.supprimer(Autre);
-                        Autre.incAttente(t_temps);
-                        temp.insererDernier(Autre);
-                    }else {
-                        travail.supprimer(Autre);
-                        temp.insererDernier(Autre);
-                    }
-                }
-
-                while (temp.taille() > 0) {
-                    Processus retour = temp.getValeur(0);
-                    temp.supprimerPremier();
-                    travail.insererDernier(retour);
-                }
-
-                t_pris.redDuree(quantum);
-                t_pris.incArrivee(quantum);
-                travail.insererDernier(t_pris);
-                copie.supprimer(C_pris);
-                copie.insererDernier(C_pris);
-                Clock += quantum;
-            }
-        }
-        for (int i = 0; i < result.taille(); i++) {
-            Attente += static_cast<float>(result.getValeur(i).getAttente());
-        }
-        float moyenneTemps = (Attente) / static_cast<float>(result.taille());
-        result.setTempsMoy(moyenneTemps);
-
-        return result;
-
+        TableProcessus table(f_entree);
+        return resultat(table, round_robin(table, f_quantum, temps), "Round Robin");
     }
 
     /**
@@ -248,49 +99,29 @@ namespace TP {
      * \return La file de processus ordonnancés avec les temps d'attente et de fin calculés.
      */
     File<Processus> priorite(const File<Processus>& f_entree, const int &temps) {
-        PRECONDITION(temps >= 0);
-        File<Processus> result;
-        File<Processus> travail(f_entree);
-        int Attente = 0;
-        int clock = temps;
-
-        result.setNomTest("priorite");
-
-        while (!travail.estVide()) {
-            int minIndex = -1 ;
-            int minPrio = -1 ;
-            int minArrivee = std::numeric_limits<int>::max();
-
-            for (int i = 0; i < travail.taille(); i++) {
-                Processus curr = travail.getValeur(i);
-
-                if (curr.getArrivee() < minArrivee) {
-                        minPrio = curr.getPriorite();
-                        minArrivee = curr.getArrivee();
-                        minIndex = i;
-                }else if (curr.getArrivee() == minArrivee) {
-                    if (curr.getPriorite() > minPrio) {
-                        minPrio = curr.getPriorite();
-                        minIndex = i;
-                    }
-                    }
-            }
-            Processus pris = travail.getValeur(minIndex);
-
-            travail.supprimer(pris);
-            pris.setAttente(clock-pris.getArrivee());
-            clock += pris.getDuree();
-            pris.setFin(clock);
-            result.insererDernier(pris);
-        }
-
-        for (int i = 0; i < result.taille(); i++) {
-            Attente += static_cast<float>(result.getValeur(i).getAttente());
-        }
-        float moyenneTemps = (Attente) / static_cast<float>(result.taille());
-        result.setTempsMoy(moyenneTemps);
+        TableProcessus table(f_entree);
+        return resultat(table, priorite(table, temps), "priorite");
+    }
 
-        return result;
+    /**
+     * \brief Algorithme par priorité préemptive avec vieillissement.
+     *
+     *        Le processus prêt de plus haute priorité effective s'exécute ; la
+     *        priorité effective d'un processus en attente monte d'un niveau par
+     *        période de vieillissement, ce qui borne l'attente des processus peu
+     *        prioritaires. Les attentes maximale et p99 de la table résultante
+     *        (TableProcessus::attenteMax(), attentePercentile(99)) servent à
+     *        régler la période.
+     *
+     * \param f_entree La file de processus d'entrée.
+     * \param vieillissement L'attente qui élève la priorité effective d'un niveau.
+     * \param temps Le temps de décalage.
+     * \return La file de processus ordonnancés avec les temps d'attente et de fin calculés.
+     */
+    File<Processus> priorite_preemptive(const File<Processus>& f_entree, const int& vieillissement,
+                                        const int &temps) {
+        TableProcessus table(f_entree);
+        return resultat(table, priorite_preemptive(table, vieillissement, temps), "priorite preemptive");
     }
 
     /**
@@ -305,69 +136,338 @@ namespace TP {
      * \return La file de processus ordonnancés avec les temps d'attente et de fin calculés.
      */
     File<Processus> multiniveaux(const File<Processus>& f_entree,const int& f_quantum, const int &temps) {
+        TableProcessus table(f_entree);
+        return resultat(table, multiniveaux(table, f_quantum, temps), "");
+    }
+
+    /**
+     * \brief Algorithme MLFQ (Multi-Level Feedback Queue).
+     *
+     *        Les processus entrent au niveau de leur type, descendent d'un niveau
+     *        chaque fois qu'ils épuisent le quantum du leur, et remontent tous à
+     *        leur niveau initial à chaque relèvement. Contrairement à
+     *        multiniveaux, un processus de calcul finit dans les niveaux bas et
+     *        les processus courts gardent la main : de quoi mesurer la latence
+     *        interactive sous une charge batch.
+     *
+     * \param f_entree La file de processus d'entrée.
+     * \param quanta Le quantum de chaque niveau, du plus important au moins important.
+     * \param relevement L'intervalle entre deux relèvements.
+     * \param temps Le temps de décalage.
+     * \return La file de processus ordonnancés avec les temps d'attente et de fin calculés.
+     */
+    File<Processus> mlfq(const File<Processus>& f_entree, const std::vector<int>& quanta, const int& relevement,
+                         const int &temps) {
+        TableProcessus table(f_entree);
+        return resultat(table, mlfq(table, quanta, relevement, temps), "MLFQ");
+    }
+
+    /**
+     * \brief Algorithme par loterie.
+     *
+     *        À chaque élection, un ticket est tiré parmi ceux des processus prêts ;
+     *        chaque processus détient sa priorité plus un tickets, et l'élu
+     *        s'exécute au plus un quantum. La part du processeur de chaque
+     *        processus tend vers sa part des tickets.
+     *
+     * \param f_entree La file de processus d'entrée.
+     * \param quantum La durée maximale d'une tranche.
+     * \param graine La graine du tirage.
+     * \param temps Le temps de décalage.
+     * \param parts Si non nul, reçoit les parts cible et obtenue par type.
+     * \return La file de processus ordonnancés avec les temps d'attente et de fin calculés.
+     */
+    File<Processus> loterie(const File<Processus>& f_entree, const int& quantum, const unsigned& graine,
+                            const int &temps, PartsParType* parts) {
+        TableProcessus table(f_entree);
+        return resultat(table, loterie(table, quantum, graine, temps, parts), "Loterie");
+    }
+
+    /**
+     * \brief Algorithme de partage par enjambées (stride scheduling).
+     *
+     *        Version déterministe de la loterie : l'élu est le processus prêt de
+     *        plus petite passe, et sa passe avance, après chaque tranche, d'autant
+     *        moins qu'il a de tickets.
+     *
+     * \param f_entree La file de processus d'entrée.
+     * \param quantum La durée maximale d'une tranche.
+     * \param temps Le temps de décalage.
+     * \param parts Si non nul, reçoit les parts cible et obtenue par type.
+     * \return La file de processus ordonnancés avec les temps d'attente et de fin calculés.
+     */
+    File<Processus> stride(const File<Processus>& f_entree, const int& quantum, const int &temps,
+                           PartsParType* parts) {
+        TableProcessus table(f_entree);
+        return resultat(table, stride(table, quantum, temps, parts), "Stride");
+    }
+
+    /**
+     * \brief Algorithme EDF (Earliest Deadline First).
+     *
+     *        Parmi les processus arrivés, celui dont l'échéance est la plus proche
+     *        est servi ; une arrivée à échéance plus proche l'interrompt. Les
+     *        processus sans échéance sont servis quand aucun autre n'est prêt.
+     *
+     * \param f_entree La file de processus d'entrée.
+     * \param temps Le temps de décalage.
+     * \param bilan Si non nul, reçoit le taux d'échéances manquées et l'histogramme des retards (10 classes).
+     * \return La file de processus ordonnancés avec les temps d'attente et de fin calculés.
+     */
+    File<Processus> edf(const File<Processus>& f_entree, const int &temps, BilanEcheances* bilan) {
+        TableProcessus table(f_entree);
+        std::vector<uint32_t> ordre = edf(table, temps);
+        if (bilan != nullptr) *bilan = table.bilanEcheances(10);
+        return resultat(table, ordre, "EDF");
+    }
+
+    /**
+     * \brief Algorithme CFS (Completely Fair Scheduler).
+     *
+     *        L'élu est le processus prêt qui a reçu le moins de temps virtuel,
+     *        c'est-à-dire de temps d'exécution rapporté à son poids ; chaque prêt
+     *        est servi environ une fois par latence cible.
+     *
+     * \param f_entree La file de processus d'entrée.
+     * \param latence La latence cible.
+     * \param granularite La tranche minimale.
+     * \param temps Le temps de décalage.
+     * \return La file de processus ordonnancés avec les temps d'attente et de fin calculés.
+     */
+    File<Processus> cfs(const File<Processus>& f_entree, const int& latence, const int& granularite,
+                        const int &temps) {
+        TableProcessus table(f_entree);
+        return resultat(table, cfs(table, latence, granularite, temps), "CFS");
+    }
+
+    /**
+     * \brief Algorithme FCFS sur une table de processus en colonnes.
+     *
+     *        Parmi les processus arrivés, le premier arrivé est servi jusqu'au
+     *        bout ; le processeur reste inactif tant que rien n'est arrivé.
+     *
+     * \param table La table des processus ; ses colonnes d'attente et de fin sont mises à jour.
+     * \param temps Le temps de décalage.
+     * \param commutation Le coût d'une commutation de contexte.
+     * \param bilan Si non nul, reçoit le bilan du processeur (commutations, utilisation, entrées-sorties).
+     * \return Les indices des processus dans leur ordre de fin.
+     */
+    std::vector<uint32_t> fcfs(TableProcessus& table, const int &temps,
+                               const CoutCommutation& commutation, BilanProcesseur* bilan) {
+        PRECONDITION(temps >= 0);
+        PolitiqueFcfs politique;
+        return simuler(table, politique, temps, commutation, bilan);
+    }
+
+    /**
+     * \brief Algorithme FJS sur une table de processus en colonnes.
+     *
+     *        Parmi les processus arrivés, le plus court est servi jusqu'au bout.
+     *
+     * \param table La table des processus.
+     * \param temps Le temps de décalage.
+     * \param commutation Le coût d'une commutation de contexte.
+     * \param bilan Si non nul, reçoit le bilan du processeur (commutations, utilisation, entrées-sorties).
+     * \return Les indices des processus dans leur ordre de fin.
+     */
+    std::vector<uint32_t> fjs(TableProcessus& table, const int &temps,
+                              const CoutCommutation& commutation, BilanProcesseur* bilan) {
+        PRECONDITION(temps >= 0);
+        PolitiqueTas<ParDuree> politique(table);
+        return simuler(table, politique, temps, commutation, bilan);
+    }
+
+    /**
+     * \brief Algorithme SRTF sur une table de processus en colonnes.
+     *
+     *        Le processus prêt au temps restant le plus court s'exécute ; une
+     *        arrivée plus courte que le temps restant du courant le préempte.
+     *
+     * \param table La table des processus.
+     * \param temps Le temps de décalage.
+     * \param commutation Le coût d'une commutation de contexte.
+     * \param bilan Si non nul, reçoit le bilan du processeur (commutations, utilisation, entrées-sorties).
+     * \return Les indices des processus dans leur ordre de fin.
+     */
+    std::vector<uint32_t> srtf(TableProcessus& table, const int &temps,
+                               const CoutCommutation& commutation, BilanProcesseur* bilan) {
+        PRECONDITION(temps >= 0);
+        PolitiqueSrtf politique(table);
+        return simuler(table, politique, temps, commutation, bilan);
+    }
+
+    /**
+     * \brief Algorithme Round Robin sur une table de processus en colonnes.
+     *
+     * \param table La table des processus.
+     * \param f_quantum Le temps de quantum pour chaque processus.
+     * \param temps Le temps de décalage.
+     * \param commutation Le coût d'une commutation de contexte.
+     * \param bilan Si non nul, reçoit le bilan du processeur (commutations, utilisation, entrées-sorties).
+     * \return Les indices des processus dans leur ordre de fin.
+     */
+    std::vector<uint32_t> round_robin(TableProcessus& table, const int& f_quantum, const int &temps,
+                                      const CoutCommutation& commutation, BilanProcesseur* bilan) {
         PRECONDITION(temps >= 0);
         PRECONDITION(f_quantum > 0);
-        File<Processus> result;
-        File<Processus> travail(f_entree);
-        File<Processus> SYSTEME;
-        File<Processus> INTERACTIF;
-        File<Processus> BATCH;
-        File<Processus> UTILISATEUR;
-        int Attente = 0;
+        PolitiqueTourniquet politique(f_quantum);
+        return simuler(table, politique, temps, commutation, bilan);
+    }
 
-        while (!travail.estVide()) {
-            Processus curr = travail.getValeur(0);
-            TypeProcessus type = curr.getType();
-            travail.supprimer(curr);
+    /**
+     * \brief Algorithme par priorité sur une table de processus en colonnes.
+     *
+     *        Parmi les processus arrivés, le plus prioritaire est servi jusqu'au bout.
+     *
+     * \param table La table des processus.
+     * \param temps Le temps de décalage.
+     * \param commutation Le coût d'une commutation de contexte.
+     * \param bilan Si non nul, reçoit le bilan du processeur (commutations, utilisation, entrées-sorties).
+     * \return Les indices des processus dans leur ordre de fin.
+     */
+    std::vector<uint32_t> priorite(TableProcessus& table, const int &temps,
+                                   const CoutCommutation& commutation, BilanProcesseur* bilan) {
+        PRECONDITION(temps >= 0);
+        PolitiqueTas<ParPriorite> politique(table);
+        return simuler(table, politique, temps, commutation, bilan);
+    }
 
-            if (type == TypeProcessus(1)) {
-                SYSTEME.insererDernier(curr);
-            }
-            else if (type == TypeProcessus(2)) {
-                INTERACTIF.insererDernier(curr);
-            }
-            else if (type == TypeProcessus(3)) {
-                BATCH.insererDernier(curr);
-            }
-            else if (type == TypeProcessus(4)) {
-                UTILISATEUR.insererDernier(curr);
-            }
-        }
-        File<Processus> Sys = TP::priorite(SYSTEME, temps);
-        while (!Sys.estVide()) {
-            Processus copie1 = Sys.getValeur(0);
-            Sys.supprimer(copie1);
-            result.insererDernier(copie1);
-        }
+    /**
+     * \brief Algorithme par priorité préemptive avec vieillissement sur une table en colonnes.
+     *
+     * \param table La table des processus.
+     * \param vieillissement L'attente qui élève la priorité effective d'un niveau.
+     * \param temps Le temps de décalage.
+     * \param commutation Le coût d'une commutation de contexte.
+     * \param bilan Si non nul, reçoit le bilan du processeur (commutations, utilisation, entrées-sorties).
+     * \return Les indices des processus dans leur ordre de fin.
+     */
+    std::vector<uint32_t> priorite_preemptive(TableProcessus& table, const int& vieillissement,
+                                              const int &temps,
+                                              const CoutCommutation& commutation, BilanProcesseur* bilan) {
+        PRECONDITION(temps >= 0);
+        PRECONDITION(vieillissement > 0);
+        PolitiquePrioriteVieillissement politique(table, vieillissement);
+        return simuler(table, politique, temps, commutation, bilan);
+    }
 
+    /**
+     * \brief Algorithme multiniveaux sur une table de processus en colonnes.
+     *
+     * \param table La table des processus.
+     * \param f_quantum Le temps de quantum pour les processus interactifs.
+     * \param temps Le temps de décalage.
+     * \param commutation Le coût d'une commutation de contexte.
+     * \param bilan Si non nul, reçoit le bilan du processeur (commutations, utilisation, entrées-sorties).
+     * \return Les indices des processus dans leur ordre de fin.
+     */
+    std::vector<uint32_t> multiniveaux(TableProcessus& table, const int& f_quantum, const int &temps,
+                                       const CoutCommutation& commutation, BilanProcesseur* bilan) {
+        PRECONDITION(temps >= 0);
+        PRECONDITION(f_quantum > 0);
+        PolitiqueMultiniveaux politique(table, f_quantum);
+        return simuler(table, politique, temps, commutation, bilan);
+    }
 
-        File<Processus> Int =TP::round_robin(INTERACTIF, f_quantum, result.getValeur(result.taille()-1).getFin());
-        while (!Int.estVide()) {
-            Processus copie2 = Int.getValeur(0);
-            Int.supprimer(copie2);
-            result.insererDernier(copie2);
-        }
-        File<Processus> batch = TP::fcfs(BATCH, result.getValeur(result.taille()-1).getFin());
-        while (!batch.estVide()) {
-            Processus copie3 = batch.getValeur(0);
-            batch.supprimer(copie3);
-            result.insererDernier(copie3);
-        }
-        File<Processus> utilisateur = TP::fcfs(UTILISATEUR, result.getValeur(result.taille()-1).getFin());
-        while (!utilisateur.estVide()) {
-            Processus copie4 = utilisateur.getValeur(0);
-            utilisateur.supprimer(copie4);
-            result.insererDernier(copie4);
-        }
+    /**
+     * \brief Algorithme MLFQ sur une table de processus en colonnes.
+     *
+     * \param table La table des processus.
+     * \param quanta Le quantum de chaque niveau, du plus important au moins important.
+     * \param relevement L'intervalle entre deux relèvements.
+     * \param temps Le temps de décalage.
+     * \param commutation Le coût d'une commutation de contexte.
+     * \param bilan Si non nul, reçoit le bilan du processeur (commutations, utilisation, entrées-sorties).
+     * \return Les indices des processus dans leur ordre de fin.
+     */
+    std::vector<uint32_t> mlfq(TableProcessus& table, const std::vector<int>& quanta, const int& relevement,
+                               const int &temps,
+                               const CoutCommutation& commutation, BilanProcesseur* bilan) {
+        PRECONDITION(temps >= 0);
+        PolitiqueMlfq politique(table, quanta, relevement);
+        return simuler(table, politique, temps, commutation, bilan);
+    }
 
-        for (int i = 0; i < result.taille(); i++) {
-            Processus copie = result.getValeur(i);
-            Attente += static_cast<float>(copie.getAttente());
-        }
-        float moyenneTemps = (Attente) / static_cast<float>(result.taille());
-        result.setTempsMoy(moyenneTemps);
+    /**
+     * \brief Algorithme par loterie sur une table de processus en colonnes.
+     *
+     * \param table La table des processus.
+     * \param quantum La durée maximale d'une tranche.
+     * \param graine La graine du tirage.
+     * \param temps Le temps de décalage.
+     * \param parts Si non nul, reçoit les parts cible et obtenue par type.
+     * \param commutation Le coût d'une commutation de contexte.
+     * \param bilan Si non nul, reçoit le bilan du processeur (commutations, utilisation, entrées-sorties).
+     * \return Les indices des processus dans leur ordre de fin.
+     */
+    std::vector<uint32_t> loterie(TableProcessus& table, const int& quantum, const unsigned& graine,
+                                  const int &temps, PartsParType* parts,
+                                  const CoutCommutation& commutation, BilanProcesseur* bilan) {
+        PRECONDITION(temps >= 0);
+        PRECONDITION(quantum > 0);
+        PolitiqueLoterie politique(table, quantum, graine);
+        std::vector<uint32_t> ordre = simuler(table, politique, temps, commutation, bilan);
+        if (parts != nullptr) *parts = politique.parts();
+        return ordre;
+    }
 
-        return result;
+    /**
+     * \brief Algorithme de partage par enjambées sur une table de processus en colonnes.
+     *
+     * \param table La table des processus.
+     * \param quantum La durée maximale d'une tranche.
+     * \param temps Le temps de décalage.
+     * \param parts Si non nul, reçoit les parts cible et obtenue par type.
+     * \param commutation Le coût d'une commutation de contexte.
+     * \param bilan Si non nul, reçoit le bilan du processeur (commutations, utilisation, entrées-sorties).
+     * \return Les indices des processus dans leur ordre de fin.
+     */
+    std::vector<uint32_t> stride(TableProcessus& table, const int& quantum, const int &temps,
+                                 PartsParType* parts, const CoutCommutation& commutation,
+                                 BilanProcesseur* bilan) {
+        PRECONDITION(temps >= 0);
+        PRECONDITION(quantum > 0);
+        PolitiqueStride politique(table, quantum);
+        std::vector<uint32_t> ordre = simuler(table, politique, temps, commutation, bilan);
+        if (parts != nullptr) *parts = politique.parts();
+        return ordre;
     }
-}
 
+    /**
+     * \brief Algorithme EDF sur une table de processus en colonnes.
+     *
+     * \param table La table des processus ; TableProcessus::bilanEcheances() donne ensuite
+     *        le respect des échéances.
+     * \param temps Le temps de décalage.
+     * \param commutation Le coût d'une commutation de contexte.
+     * \param bilan Si non nul, reçoit le bilan du processeur (commutations, utilisation, entrées-sorties).
+     * \return Les indices des processus dans leur ordre de fin.
+     */
+    std::vector<uint32_t> edf(TableProcessus& table, const int &temps,
+                              const CoutCommutation& commutation, BilanProcesseur* bilan) {
+        PRECONDITION(temps >= 0);
+        PolitiqueEdf politique(table);
+        return simuler(table, politique, temps, commutation, bilan);
+    }
+
+    /**
+     * \brief Algorithme CFS sur une table de processus en colonnes.
+     *
+     * \param table La table des processus ; ses colonnes d'attente et de fin sont mises à jour.
+     * \param latence La latence cible.
+     * \param granularite La tranche minimale.
+     * \param temps Le temps de décalage.
+     * \param commutation Le coût d'une commutation de contexte.
+     * \param bilan Si non nul, reçoit le bilan du processeur (commutations, utilisation, entrées-sorties).
+     * \return Les indices des processus dans leur ordre de fin.
+     */
+    std::vector<uint32_t> cfs(TableProcessus& table, const int& latence, const int& granularite,
+                              const int &temps,
+                              const CoutCommutation& commutation, BilanProcesseur* bilan) {
+        PRECONDITION(temps >= 0);
+        PRECONDITION(latence > 0);
+        PRECONDITION(granularite > 0);
+        PolitiqueCfs politique(table, latence, granularite);
+        return simuler(table, politique, temps, commutation, bilan);
+    }
+}
@@ -5,28 +5,88 @@
  *        Ce fichier contient les prototypes des fonctions d'ordonnancement
  *        utilisées dans la simulation de gestion des processus. Ces fonctions
  *        prennent en entrée une file de processus et un temps donné, et retournent
- *        une file de processus ordonnancés selon la méthode spécifiée.
+ *        une file de processus ordonnancés selon la méthode spécifiée. Toutes
+ *        reposent sur le moteur à événements discrets de Simulation.h ; les
+ *        versions sur table acceptent en plus un coût de commutation de contexte
+ *        (CoutCommutation) et rendent, sur demande, le bilan du processeur :
+ *        commutations, utilisation et recouvrement des entrées-sorties des
+ *        processus qui en font (voir TableProcessus::definirRafales()).
  *
  *        Les méthodes d'ordonnancement incluses sont :
  *        - FCFS (First-Come, First-Served)
  *        - FJS (Shortest Job First)
+ *        - SRTF (Shortest Remaining Time First, préemptif)
  *        - Round Robin
  *        - Priorité
+ *        - Priorité préemptive avec vieillissement
  *        - Multiniveaux
+ *        - MLFQ (Multi-Level Feedback Queue)
+ *        - Loterie et partage par enjambées (stride), à partage proportionnel
+ *        - EDF (Earliest Deadline First, préemptif), pour les processus à échéance
+ *        - CFS (Completely Fair Scheduler), à temps virtuel pondéré comme Linux
  */
 
 #ifndef ORDONNANCEUR_H
 #define ORDONNANCEUR_H
 #include "File.h"
 #include "Processus.h"
+#include "Simulation.h"
+#include "TableProcessus.h"
+#include <cstdint>
+#include <vector>
 
+struct PartsParType;
 
 namespace TP {
   File<Processus> fcfs(const File<Processus>& f_entree, const int& temps);
   File<Processus> fjs(const File<Processus>& f_entree, const int& temps);
+  File<Processus> srtf(const File<Processus>& f_entree, const int& temps);
   File<Processus> round_robin(const File<Processus>& f_entree,const int& quantum, const int& temps);
   File<Processus> priorite(const File<Processus>& f_entree, const int& temps);
+  File<Processus> priorite_preemptive(const File<Processus>& f_entree, const int& vieillissement, const int& temps);
   File<Processus> multiniveaux(const File<Processus>& f_entree,const int& quantum, const int& temps);
+  File<Processus> mlfq(const File<Processus>& f_entree, const std::vector<int>& quanta, const int& relevement,
+                       const int& temps);
+  File<Processus> loterie(const File<Processus>& f_entree, const int& quantum, const unsigned& graine,
+                          const int& temps, PartsParType* parts = nullptr);
+  File<Processus> stride(const File<Processus>& f_entree, const int& quantum, const int& temps,
+                         PartsParType* parts = nullptr);
+  File<Processus> edf(const File<Processus>& f_entree, const int& temps, BilanEcheances* bilan = nullptr);
+  File<Processus> cfs(const File<Processus>& f_entree, const int& latence, const int& granularite,
+                      const int& temps);
+
+  std::vector<uint32_t> fcfs(TableProcessus& table, const int& temps,
+                             const CoutCommutation& commutation = CoutCommutation(), BilanProcesseur* bilan = nullptr);
+  std::vector<uint32_t> fjs(TableProcessus& table, const int& temps,
+                            const CoutCommutation& commutation = CoutCommutation(), BilanProcesseur* bilan = nullptr);
+  std::vector<uint32_t> srtf(TableProcessus& table, const int& temps,
+                             const CoutCommutation& commutation = CoutCommutation(), BilanProcesseur* bilan = nullptr);
+  std::vector<uint32_t> round_robin(TableProcessus& table, const int& quantum, const int& temps,
+                                    const CoutCommutation& commutation = CoutCommutation(),
+                                    BilanProcesseur* bilan = nullptr);
+  std::vector<uint32_t> priorite(TableProcessus& table, const int& temps,
+                                 const CoutCommutation& commutation = CoutCommutation(),
+                                 BilanProcesseur* bilan = nullptr);
+  std::vector<uint32_t> priorite_preemptive(TableProcessus& table, const int& vieillissement, const int& temps,
+                                            const CoutCommutation& commutation = CoutCommutation(),
+                                            BilanProcesseur* bilan = nullptr);
+  std::vector<uint32_t> multiniveaux(TableProcessus& table, const int& quantum, const int& temps,
+                                     const CoutCommutation& commutation = CoutCommutation(),
+                                     BilanProcesseur* bilan = nullptr);
+  std::vector<uint32_t> mlfq(TableProcessus& table, const std::vector<int>& quanta, const int& relevement,
+                             const int& temps, const CoutCommutation& commutation = CoutCommutation(),
+                             BilanProcesseur* bilan = nullptr);
+  std::vector<uint32_t> loterie(TableProcessus& table, const int& quantum, const unsigned& graine,
+                                const int& temps, PartsParType* parts = nullptr,
+                                const CoutCommutation& commutation = CoutCommutation(),
+                                BilanProcesseur* bilan = nullptr);
+  std::vector<uint32_t> stride(TableProcessus& table, const int& quantum, const int& temps,
+                               PartsParType* parts = nullptr, const CoutCommutation& commutation = CoutCommutation(),
+                               BilanProcesseur* bilan = nullptr);
+  std::vector<uint32_t> edf(TableProcessus& table, const int& temps,
+                            const CoutCommutation& commutation = CoutCommutation(), BilanProcesseur* bilan = nullptr);
+  std::vector<uint32_t> cfs(TableProcessus& table, const int& latence, const int& granularite, const int& temps,
+                            const CoutCommutation& commutation = CoutCommutation(), BilanProcesseur* bilan = nullptr);
 }
 
 #endif //ORDONNANCEUR_H
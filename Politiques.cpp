@@ -0,0 +1,1000 @@
+#include "Politiques.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+/**
+ * \brief Rend un processus prêt, à la fin de la file.
+ * \param[in] i Indice du processus dans la table.
+ */
+void FilePrets::ajouter(uint32_t i, int) {
+    m_prets.insererDernier(i);
+}
+
+/**
+ * \brief Un processus qui se bloque n'a rien à laisser dans la file : il reviendra par ajouter().
+ */
+void FilePrets::bloquer(uint32_t, int) {
+}
+
+/**
+ * \brief Vérifie si aucun processus n'est prêt.
+ */
+bool FilePrets::estVide() const {
+    return m_prets.estVide();
+}
+
+/**
+ * \brief Retire le processus en tête de file.
+ * \return Son indice dans la table.
+ * \pre !estVide()
+ */
+uint32_t FilePrets::extraire(int) {
+    PRECONDITION(!estVide());
+    uint32_t i = m_prets.getValeur(0);
+    m_prets.supprimerPremier();
+    return i;
+}
+
+/**
+ * \brief L'élu s'exécute jusqu'au bout.
+ */
+int PolitiqueFcfs::tranche(uint32_t, int) const {
+    return TRANCHE_ILLIMITEE;
+}
+
+/**
+ * \brief Politique non préemptive : jamais d'interruption.
+ */
+bool PolitiqueFcfs::preempte(uint32_t, int) const {
+    return false;
+}
+
+/**
+ * \brief Constructeur.
+ * \param[in] quantum Durée maximale d'une tranche.
+ * \pre quantum > 0
+ */
+PolitiqueTourniquet::PolitiqueTourniquet(int quantum) : m_quantum(quantum) {
+    PRECONDITION(quantum > 0);
+}
+
+/**
+ * \brief L'élu s'exécute au plus un quantum.
+ */
+int PolitiqueTourniquet::tranche(uint32_t, int) const {
+    return m_quantum;
+}
+
+/**
+ * \brief Une arrivée n'interrompt pas la tranche en cours.
+ */
+bool PolitiqueTourniquet::preempte(uint32_t, int) const {
+    return false;
+}
+
+/**
+ * \brief Constructeur : tas vide, dimensionné pour toute la table.
+ * \param[in] table La table des processus, pour lire leur temps restant.
+ */
+PolitiqueSrtf::PolitiqueSrtf(const TableProcessus& table) : m_table(table) {
+    m_prets.reserver(table.taille());
+}
+
+/**
+ * \brief Rend un processus prêt, en O(log n).
+ */
+void PolitiqueSrtf::ajouter(uint32_t i, int) {
+    m_prets.inserer(PretSrtf{m_table.restants()[i], i});
+}
+
+/**
+ * \brief Un processus qui se bloque n'a rien à laisser dans la file : il reviendra par ajouter().
+ */
+void PolitiqueSrtf::bloquer(uint32_t, int) {
+}
+
+/**
+ * \brief Vérifie si aucun processus n'est prêt.
+ */
+bool PolitiqueSrtf::estVide() const {
+    return m_prets.estVide();
+}
+
+/**
+ * \brief Retire le processus prêt au temps restant le plus court, en O(log n).
+ * \pre !estVide()
+ */
+uint32_t PolitiqueSrtf::extraire(int) {
+    return m_prets.extraireSommet().index;
+}
+
+/**
+ * \brief L'élu s'exécute jusqu'à sa fin ou jusqu'à la prochaine préemption.
+ */
+int PolitiqueSrtf::tranche(uint32_t, int) const {
+    return TRANCHE_ILLIMITEE;
+}
+
+/**
+ * \brief Interrompt le courant si un processus prêt se terminerait plus tôt.
+ */
+bool PolitiqueSrtf::preempte(uint32_t courant, int) const {
+    return !m_prets.estVide() && m_prets.sommet().restant < m_table.restants()[courant];
+}
+
+/**
+ * \brief Constructeur : tas vide, dimensionné pour toute la table.
+ * \param[in] table La table dont la colonne des échéances est lue.
+ */
+PolitiqueEdf::PolitiqueEdf(const TableProcessus& table) : m_table(table) {
+    m_prets.reserver(table.taille());
+}
+
+/**
+ * \brief Rend un processus prêt, en O(log n).
+ */
+void PolitiqueEdf::ajouter(uint32_t i, int) {
+    m_prets.inserer(PretEdf{cle(i), i});
+}
+
+/**
+ * \brief Un processus qui se bloque n'a rien à laisser dans la file : il reviendra par ajouter().
+ */
+void PolitiqueEdf::bloquer(uint32_t, int) {
+}
+
+/**
+ * \brief Vérifie si aucun processus n'est prêt.
+ */
+bool PolitiqueEdf::estVide() const {
+    return m_prets.estVide();
+}
+
+/**
+ * \brief Retire le processus prêt d'échéance la plus proche, en O(log n).
+ * \pre !estVide()
+ */
+uint32_t PolitiqueEdf::extraire(int) {
+    PRECONDITION(!estVide());
+    return m_prets.extraireSommet().index;
+}
+
+/**
+ * \brief L'élu s'exécute jusqu'au bout, sauf préemption.
+ */
+int PolitiqueEdf::tranche(uint32_t, int) const {
+    return TRANCHE_ILLIMITEE;
+}
+
+/**
+ * \brief Préempte si un processus prêt a une échéance strictement plus proche.
+ */
+bool PolitiqueEdf::preempte(uint32_t courant, int) const {
+    return !m_prets.estVide() && m_prets.sommet().echeance < cle(courant);
+}
+
+/**
+ * \brief Clé du tas : l'échéance, ou +infini pour un processus qui n'en a pas.
+ */
+long long PolitiqueEdf::cle(uint32_t i) const {
+    int echeance = m_table.echeances()[i];
+    return echeance == Processus::AUCUNE_ECHEANCE ? std::numeric_limits<long long>::max() : echeance;
+}
+
+/**
+ * \brief Constructeur.
+ * \param[in] table La table des processus, pour lire leur priorité.
+ * \param[in] periode Attente qui élève la priorité effective d'un niveau ;
+ *            std::numeric_limits<int>::max() désactive en pratique le vieillissement.
+ * \pre periode > 0
+ */
+PolitiquePrioriteVieillissement::PolitiquePrioriteVieillissement(const TableProcessus& table, int periode)
+    : m_table(table), m_periode(periode), m_attente(std::make_shared<std::vector<int>>(table.taille(), 0)) {
+    PRECONDITION(periode > 0);
+    m_prets.reserver(table.taille());
+}
+
+/**
+ * \brief Rend un processus prêt ; il reprend son vieillissement là où il l'avait laissé.
+ * \param[in] i Indice du processus dans la table.
+ * \param[in] horloge L'instant courant.
+ */
+void PolitiquePrioriteVieillissement::ajouter(uint32_t i, int horloge) {
+    m_prets.inserer(PretVieilli{m_table.priorites()[i] * m_periode + (*m_attente)[i] - horloge, i});
+}
+
+/**
+ * \brief Un processus bloqué ne vieillit pas : son attente reprend à son réveil.
+ */
+void PolitiquePrioriteVieillissement::bloquer(uint32_t, int) {
+}
+
+/**
+ * \brief Vérifie si aucun processus n'est prêt.
+ */
+bool PolitiquePrioriteVieillissement::estVide() const {
+    return m_prets.estVide();
+}
+
+/**
+ * \brief Retire le processus de plus haute priorité effective, en O(log n).
+ * \param[in] horloge L'instant de l'élection, qui fige la priorité effective de l'élu.
+ * \pre !estVide()
+ */
+uint32_t PolitiquePrioriteVieillissement::extraire(int horloge) {
+    PRECONDITION(!estVide());
+    PretVieilli elu = m_prets.extraireSommet();
+    (*m_attente)[elu.index] = static_cast<int>(horloge + elu.cle - m_table.priorites()[elu.index] * m_periode);
+    return elu.index;
+}
+
+/**
+ * \brief Durée avant que le meilleur processus prêt ne dépasse l'élu par vieillissement.
+ */
+int PolitiquePrioriteVieillissement::tranche(uint32_t i, int horloge) const {
+    if (m_prets.estVide()) return TRANCHE_ILLIMITEE;
+    // Premier instant t tel que (t + cle) / periode > effectiveElu(i).
+    long long depassement = (effectiveElu(i) + 1) * m_periode - m_prets.sommet().cle;
+    return static_cast<int>(std::min<long long>(depassement - horloge, TRANCHE_ILLIMITEE));
+}
+
+/**
+ * \brief Interrompt l'élu si un processus prêt a une priorité effective strictement plus haute.
+ */
+bool PolitiquePrioriteVieillissement::preempte(uint32_t courant, int horloge) const {
+    return !m_prets.estVide() && effective(m_prets.sommet().cle, horloge) > effectiveElu(courant);
+}
+
+/**
+ * \brief Priorité effective, à l'instant horloge, d'une entrée de clé cle.
+ */
+long long PolitiquePrioriteVieillissement::effective(long long cle, int horloge) const {
+    return (horloge + cle) / m_periode;
+}
+
+/**
+ * \brief Priorité effective, figée à l'élection, d'un processus en cours d'exécution.
+ */
+long long PolitiquePrioriteVieillissement::effectiveElu(uint32_t i) const {
+    return m_table.priorites()[i] + (*m_attente)[i] / m_periode;
+}
+
+/**
+ * \brief Constructeur.
+ * \param[in] table La table des processus, pour lire leur type et leur priorité.
+ * \param[in] quantum Le quantum du niveau interactif.
+ * \pre quantum > 0
+ */
+PolitiqueMultiniveaux::PolitiqueMultiniveaux(const TableProcessus& table, int quantum)
+    : m_table(table), m_systeme(table), m_interactif(quantum) {
+}
+
+/**
+ * \brief Rend un processus prêt dans la file de son type.
+ * \param[in] i Indice du processus dans la table.
+ * \param[in] horloge L'instant courant.
+ */
+void PolitiqueMultiniveaux::ajouter(uint32_t i, int horloge) {
+    switch (m_table.types()[i]) {
+        case TypeProcessus::SYSTEME:
+            m_systeme.ajouter(i, horloge);
+        break;
+        case TypeProcessus::INTERACTIF:
+            m_interactif.ajouter(i, horloge);
+        break;
+        case TypeProcessus::BATCH:
+            m_batch.ajouter(i, horloge);
+        break;
+        case TypeProcessus::UTILISATEUR:
+            m_utilisateur.ajouter(i, horloge);
+        break;
+    }
+}
+
+/**
+ * \brief Un processus qui se bloque n'a rien à laisser dans la file : il reviendra par ajouter().
+ */
+void PolitiqueMultiniveaux::bloquer(uint32_t, int) {
+}
+
+/**
+ * \brief Vérifie si aucun niveau n'a de processus prêt.
+ */
+bool PolitiqueMultiniveaux::estVide() const {
+    return m_systeme.estVide() && m_interactif.estVide() && m_batch.estVide() && m_utilisateur.estVide();
+}
+
+/**
+ * \brief Retire le prochain élu du niveau non vide le plus important.
+ * \pre !estVide()
+ */
+uint32_t PolitiqueMultiniveaux::extraire(int horloge) {
+    PRECONDITION(!estVide());
+    if (!m_systeme.estVide()) return m_systeme.extraire(horloge);
+    if (!m_interactif.estVide()) return m_interactif.extraire(horloge);
+    if (!m_batch.estVide()) return m_batch.extraire(horloge);
+    return m_utilisateur.extraire(horloge);
+}
+
+/**
+ * \brief Un quantum pour les interactifs, sans limite pour les autres niveaux.
+ */
+int PolitiqueMultiniveaux::tranche(uint32_t i, int horloge) const {
+    if (m_table.types()[i] == TypeProcessus::INTERACTIF) {
+        return m_interactif.tranche(i, horloge);
+    }
+    return TRANCHE_ILLIMITEE;
+}
+
+/**
+ * \brief Interrompt le processus courant si un niveau plus important a un processus prêt.
+ */
+bool PolitiqueMultiniveaux::preempte(uint32_t courant, int) const {
+    return niveauPrets() < static_cast<int>(m_table.types()[courant]);
+}
+
+/**
+ * \brief Numéro (valeur du TypeProcessus) du niveau non vide le plus important.
+ * \return Ce numéro, ou un de plus que le dernier niveau si tous sont vides.
+ */
+int PolitiqueMultiniveaux::niveauPrets() const {
+    if (!m_systeme.estVide()) return static_cast<int>(TypeProcessus::SYSTEME);
+    if (!m_interactif.estVide()) return static_cast<int>(TypeProcessus::INTERACTIF);
+    if (!m_batch.estVide()) return static_cast<int>(TypeProcessus::BATCH);
+    if (!m_utilisateur.estVide()) return static_cast<int>(TypeProcessus::UTILISATEUR);
+    return static_cast<int>(TypeProcessus::UTILISATEUR) + 1;
+}
+
+namespace {
+    /**
+     * \brief Indice du bit de poids faible à 1 d'un masque non nul.
+     */
+    int premierBit(uint64_t masque) {
+#if defined(__GNUC__)
+        return __builtin_ctzll(masque);
+#else
+        int bit = 0;
+        while ((masque & 1u) == 0) {
+            masque >>= 1;
+            ++bit;
+        }
+        return bit;
+#endif
+    }
+}
+
+const size_t PolitiqueMlfq::NIVEAUX_MAX;
+const int PolitiqueMlfq::HORS_PROCESSEUR;
+const int PolitiqueMlfq::BLOQUE;
+
+/**
+ * \brief Constructeur.
+ * \param[in] table La table des processus, pour lire leur type.
+ * \param[in] quanta Le quantum de chaque niveau, du plus important au moins important.
+ * \param[in] periodeRelevement Intervalle entre deux relèvements ;
+ *            std::numeric_limits<int>::max() les désactive en pratique.
+ * \pre 0 < quanta.size() <= NIVEAUX_MAX, chaque quantum > 0, periodeRelevement > 0
+ */
+PolitiqueMlfq::PolitiqueMlfq(const TableProcessus& table, const std::vector<int>& quanta, int periodeRelevement)
+    : m_table(table), m_quanta(quanta), m_periodeRelevement(periodeRelevement),
+      m_prochainRelevement(periodeRelevement), m_epoque(0), m_niveaux(quanta.size()), m_nonVides(0),
+      m_etats(std::make_shared<std::vector<Etat>>(table.taille(), Etat{0, 0, 0, HORS_PROCESSEUR})) {
+    PRECONDITION(!quanta.empty() && quanta.size() <= NIVEAUX_MAX);
+    PRECONDITION(std::all_of(quanta.begin(), quanta.end(), [](int q) { return q > 0; }));
+    PRECONDITION(periodeRelevement > 0);
+}
+
+/**
+ * \brief Rend un processus prêt.
+ *
+ *        Une arrivée entre à son niveau initial. Un processus qui sort du
+ *        processeur ajoute sa tranche à son quantum consommé et descend d'un
+ *        niveau s'il l'a épuisé. Un processus qui revient d'une entrée-sortie
+ *        rentre au niveau où il s'est bloqué.
+ *
+ * \param[in] i Indice du processus dans la table.
+ * \param[in] horloge L'instant courant.
+ */
+void PolitiqueMlfq::ajouter(uint32_t i, int horloge) {
+    relever(horloge);
+    Etat& e = etat(i);
+    if (e.debut == BLOQUE) {
+        e.debut = HORS_PROCESSEUR;
+    } else if (e.debut != HORS_PROCESSEUR) {
+        sortir(e, horloge);
+        e.debut = HORS_PROCESSEUR;
+    } else {
+        e.niveau = niveauInitial(i);
+        e.consomme = 0;
+    }
+    m_niveaux[e.niveau].insererDernier(i);
+    m_nonVides |= uint64_t(1) << e.niveau;
+}
+
+/**
+ * \brief L'élu se bloque : sa tranche compte dans son quantum consommé, comme à la fin
+ *        d'une tranche, mais il garde son niveau s'il ne l'a pas épuisé.
+ * \param[in] i Indice du processus dans la table.
+ * \param[in] horloge L'instant courant.
+ */
+void PolitiqueMlfq::bloquer(uint32_t i, int horloge) {
+    relever(horloge);
+    Etat& e = etat(i);
+    PRECONDITION(e.debut >= 0);
+    sortir(e, horloge);
+    e.debut = BLOQUE;
+}
+
+/**
+ * \brief Vérifie si aucun niveau n'a de processus prêt.
+ */
+bool PolitiqueMlfq::estVide() const {
+    return m_nonVides == 0;
+}
+
+/**
+ * \brief Retire le prochain élu du niveau non vide le plus important, en O(1).
+ * \param[in] horloge L'instant de l'élection.
+ * \pre !estVide()
+ */
+uint32_t PolitiqueMlfq::extraire(int horloge) {
+    PRECONDITION(!estVide());
+    relever(horloge);
+    File<uint32_t>& file = m_niveaux[niveauPrets()];
+    uint32_t i = file.getValeur(0);
+    file.supprimerPremier();
+    if (file.estVide()) m_nonVides &= ~(uint64_t(1) << niveauPrets());
+    etat(i).debut = horloge;
+    return i;
+}
+
+/**
+ * \brief Reste du quantum du niveau de l'élu, écourté au prochain relèvement.
+ */
+int PolitiqueMlfq::tranche(uint32_t i, int horloge) const {
+    const Etat& e = (*m_etats)[i];
+    int consomme = e.epoque == m_epoque ? e.consomme : 0;
+    int niveau = e.epoque == m_epoque ? e.niveau : 0;
+    int reste = m_quanta[niveau] - consomme - (horloge - debutComptage(e));
+    return std::max(1, std::min(reste, m_prochainRelevement - horloge));
+}
+
+/**
+ * \brief Interrompt le processus courant si un niveau plus important a un processus prêt.
+ */
+bool PolitiqueMlfq::preempte(uint32_t courant, int) const {
+    return m_nonVides != 0 && niveauPrets() < niveau(courant);
+}
+
+/**
+ * \brief Niveau actuel d'un processus.
+ * \param[in] i Indice du processus dans la table.
+ */
+int PolitiqueMlfq::niveau(uint32_t i) const {
+    PRECONDITION(i < m_etats->size());
+    const Etat& e = (*m_etats)[i];
+    return e.epoque == m_epoque ? e.niveau : 0;
+}
+
+/**
+ * \brief État d'un processus, remis au niveau 0 s'il date d'avant le dernier relèvement.
+ */
+PolitiqueMlfq::Etat& PolitiqueMlfq::etat(uint32_t i) {
+    Etat& e = (*m_etats)[i];
+    if (e.epoque < m_epoque) {
+        e.epoque = m_epoque;
+        e.niveau = 0;
+        e.consomme = 0;
+    }
+    return e;
+}
+
+/**
+ * \brief Niveau d'entrée d'un processus, selon son type.
+ */
+int PolitiqueMlfq::niveauInitial(uint32_t i) const {
+    int niveau = static_cast<int>(m_table.types()[i]) - static_cast<int>(TypeProcessus::SYSTEME);
+    return std::min(niveau, static_cast<int>(m_quanta.size()) - 1);
+}
+
+/**
+ * \brief Niveau non vide le plus important.
+ * \pre !estVide()
+ */
+int PolitiqueMlfq::niveauPrets() const {
+    return premierBit(m_nonVides);
+}
+
+/**
+ * \brief Instant à partir duquel la tranche en cours compte dans le quantum consommé.
+ *
+ *        Un relèvement survenu pendant la tranche remet le compte à zéro.
+ */
+int PolitiqueMlfq::debutComptage(const Etat& e) const {
+    long long relevement = static_cast<long long>(m_epoque) * m_periodeRelevement;
+    return static_cast<int>(std::max<long long>(e.debut, relevement));
+}
+
+/**
+ * \brief Ajoute la tranche qui s'achève au quantum consommé ; descend d'un niveau s'il est épuisé.
+ */
+void PolitiqueMlfq::sortir(Etat& e, int horloge) {
+    e.consomme += horloge - debutComptage(e);
+    if (e.consomme >= m_quanta[e.niveau]) {
+        e.consomme = 0;
+        e.niveau = std::min(e.niveau + 1, static_cast<int>(m_quanta.size()) - 1);
+    }
+}
+
+/**
+ * \brief Remonte tous les processus au niveau 0 si un relèvement est dû.
+ *
+ *        Les files sont concaténées du niveau le plus important au moins
+ *        important, en O(N). L'époque est le numéro du dernier relèvement,
+ *        horloge / periodeRelevement : toutes les copies de la politique s'y
+ *        accordent, et en changer remet à zéro le niveau et le quantum consommé
+ *        de tous les processus, y compris ceux qui s'exécutent.
+ *
+ * \param[in] horloge L'instant courant.
+ */
+void PolitiqueMlfq::relever(int horloge) {
+    if (horloge < m_prochainRelevement) return;
+    m_epoque = horloge / m_periodeRelevement;
+    m_prochainRelevement = m_epoque * m_periodeRelevement;
+    m_prochainRelevement += std::min(m_periodeRelevement, std::numeric_limits<int>::max() - m_prochainRelevement);
+
+    for (size_t niveau = 1; niveau < m_niveaux.size(); ++niveau) {
+        m_niveaux[0].concatener(std::move(m_niveaux[niveau]));
+    }
+    m_nonVides = m_niveaux[0].estVide() ? 0 : 1u;
+}
+
+/**
+ * \brief Tableau des parts par type, une ligne par type.
+ */
+std::string PartsParType::toString() const {
+    static const char* const NOMS[TYPES] = {"SYSTEME", "INTERACTIF", "BATCH", "UTILISATEUR"};
+    std::ostringstream os;
+    os << std::left << std::setw(14) << "type" << std::right << std::setw(10) << "cible"
+       << std::setw(10) << "obtenue" << std::setw(14) << "retard max" << std::endl;
+    for (size_t t = 0; t < TYPES; ++t) {
+        os << std::left << std::setw(14) << NOMS[t] << std::right << std::fixed << std::setprecision(3)
+           << std::setw(10) << cible[t] << std::setw(10) << obtenue[t] << std::setprecision(1)
+           << std::setw(14) << retardMax[t] << std::endl;
+    }
+    return os.str();
+}
+
+/**
+ * \brief Nombre de tickets d'un processus : sa priorité plus un, au moins un.
+ * \param[in] table La table des processus.
+ * \param[in] i Indice du processus dans la table.
+ */
+int tickets(const TableProcessus& table, uint32_t i) {
+    return std::max(table.priorites()[i], 0) + 1;
+}
+
+/**
+ * \brief Constructeur : aucun processus actif, rien de mesuré.
+ * \param[in] table La table dont les colonnes type, priorité, restant et fin sont lues.
+ */
+ComptePartage::ComptePartage(const TableProcessus& table)
+    : m_table(&table), m_instant(0), m_elu(AUCUN), m_total(0), m_tickets(), m_cible(), m_obtenu(),
+      m_retard(), m_retardMax(), m_actifs(table.taille(), false) {
+}
+
+/**
+ * \brief Signale qu'un processus devient prêt ; à son arrivée ou à son réveil, ses
+ *        tickets entrent dans l'ensemble des processus actifs.
+ */
+void ComptePartage::ajouter(uint32_t i, int horloge) {
+    suivre(horloge);
+    if (m_elu == i) m_elu = AUCUN;
+    if (!m_actifs[i]) {
+        m_actifs[i] = true;
+        m_tickets[type(i)] += tickets(*m_table, i);
+        m_total += tickets(*m_table, i);
+    }
+}
+
+/**
+ * \brief Signale que l'élu se bloque : ses tickets sortent de l'ensemble des processus
+ *        actifs jusqu'à ce qu'il redevienne prêt.
+ */
+void ComptePartage::bloquer(uint32_t i, int horloge) {
+    suivre(horloge);
+    if (m_elu == i) m_elu = AUCUN;
+    if (m_actifs[i]) {
+        m_actifs[i] = false;
+        m_tickets[type(i)] -= tickets(*m_table, i);
+        m_total -= tickets(*m_table, i);
+    }
+}
+
+/**
+ * \brief Signale l'élection d'un processus prêt.
+ */
+void ComptePartage::elire(uint32_t i, int horloge) {
+    suivre(horloge);
+    m_elu = i;
+}
+
+/**
+ * \brief Parts cumulées jusqu'au dernier événement, fin du dernier élu comprise.
+ */
+PartsParType ComptePartage::parts() const {
+    ComptePartage bilan(*this);
+    bilan.suivre(bilan.m_instant);
+
+    PartsParType parts;
+    double cible = 0;
+    double obtenu = 0;
+    for (size_t t = 0; t < PartsParType::TYPES; ++t) {
+        cible += bilan.m_cible[t];
+        obtenu += bilan.m_obtenu[t];
+    }
+    for (size_t t = 0; t < PartsParType::TYPES; ++t) {
+        parts.cible[t] = cible == 0 ? 0 : bilan.m_cible[t] / cible;
+        parts.obtenue[t] = obtenu == 0 ? 0 : bilan.m_obtenu[t] / obtenu;
+        parts.retardMax[t] = bilan.m_retardMax[t];
+    }
+    return parts;
+}
+
+/**
+ * \brief Indice du type d'un processus dans PartsParType.
+ */
+size_t ComptePartage::type(uint32_t i) const {
+    int t = static_cast<int>(m_table->types()[i]) - static_cast<int>(TypeProcessus::SYSTEME);
+    return static_cast<size_t>(std::min(std::max(t, 0), static_cast<int>(PartsParType::TYPES) - 1));
+}
+
+/**
+ * \brief Cumule les parts de l'intervalle écoulé depuis le dernier événement, s'il
+ *        y avait concurrence entre types, et relève l'écart de chaque type.
+ */
+void ComptePartage::avancer(int horloge) {
+    if (horloge <= m_instant) return;
+    double duree = horloge - m_instant;
+    size_t types = 0;
+    for (long long t : m_tickets) {
+        if (t > 0) ++types;
+    }
+    if (types >= 2) {
+        for (size_t t = 0; t < PartsParType::TYPES; ++t) {
+            double cible = duree * static_cast<double>(m_tickets[t]) / static_cast<double>(m_total);
+            double obtenu = (m_elu != AUCUN && type(m_elu) == t) ? duree : 0;
+            m_cible[t] += cible;
+            m_obtenu[t] += obtenu;
+            m_retard[t] += cible - obtenu;
+            m_retardMax[t] = std::max(m_retardMax[t], std::abs(m_retard[t]));
+        }
+    }
+    m_instant = horloge;
+}
+
+/**
+ * \brief Avance jusqu'à horloge ; si l'élu a terminé entre-temps, avance d'abord jusqu'à
+ *        sa fin et retire ses tickets.
+ */
+void ComptePartage::suivre(int horloge) {
+    if (m_elu != AUCUN && m_table->restants()[m_elu] == 0) {
+        avancer(m_table->fins()[m_elu]);
+        m_tickets[type(m_elu)] -= tickets(*m_table, m_elu);
+        m_total -= tickets(*m_table, m_elu);
+        m_elu = AUCUN;
+    }
+    avancer(horloge);
+}
+
+/**
+ * \brief Constructeur.
+ * \param[in] table La table des processus.
+ * \param[in] quantum Durée maximale d'une tranche.
+ * \param[in] graine Graine du générateur pseudo-aléatoire.
+ * \pre quantum > 0
+ */
+PolitiqueLoterie::PolitiqueLoterie(const TableProcessus& table, int quantum, unsigned graine)
+    : m_table(table), m_quantum(quantum), m_generateur(graine), m_arbre(table.taille() + 1, 0), m_total(0),
+      m_compte(table) {
+    PRECONDITION(quantum > 0);
+}
+
+/**
+ * \brief Rend un processus prêt : ses tickets entrent dans l'arbre, en O(log n).
+ */
+void PolitiqueLoterie::ajouter(uint32_t i, int horloge) {
+    modifier(i, tickets(m_table, i));
+    m_compte.ajouter(i, horloge);
+}
+
+/**
+ * \brief L'élu se bloque : ses tickets, déjà retirés de l'arbre, n'y reviendront qu'au réveil.
+ */
+void PolitiqueLoterie::bloquer(uint32_t i, int horloge) {
+    m_compte.bloquer(i, horloge);
+}
+
+/**
+ * \brief Vérifie si aucun processus n'est prêt.
+ */
+bool PolitiqueLoterie::estVide() const {
+    return m_total == 0;
+}
+
+/**
+ * \brief Tire un ticket et retire son détenteur, en O(log n).
+ * \pre !estVide()
+ */
+uint32_t PolitiqueLoterie::extraire(int horloge) {
+    PRECONDITION(!estVide());
+    std::uniform_int_distribution<long long> tirage(0, m_total - 1);
+    uint32_t i = detenteur(tirage(m_generateur));
+    modifier(i, -tickets(m_table, i));
+    m_compte.elire(i, horloge);
+    return i;
+}
+
+/**
+ * \brief L'élu s'exécute au plus un quantum.
+ */
+int PolitiqueLoterie::tranche(uint32_t, int) const {
+    return m_quantum;
+}
+
+/**
+ * \brief Les arrivées attendent le prochain tirage : jamais d'interruption.
+ */
+bool PolitiqueLoterie::preempte(uint32_t, int) const {
+    return false;
+}
+
+/**
+ * \brief Parts du processeur par type, cibles et obtenues (voir ComptePartage).
+ */
+PartsParType PolitiqueLoterie::parts() const {
+    return m_compte.parts();
+}
+
+/**
+ * \brief Ajoute delta aux tickets du processus i dans l'arbre de Fenwick.
+ */
+void PolitiqueLoterie::modifier(uint32_t i, long long delta) {
+    m_total += delta;
+    for (size_t k = i + 1; k < m_arbre.size(); k += k & (~k + 1)) {
+        m_arbre[k] += delta;
+    }
+}
+
+/**
+ * \brief Processus qui détient le ticket numéro ticket, les tickets étant numérotés
+ *        par ordre d'indice de processus.
+ * \pre 0 <= ticket < m_total
+ */
+uint32_t PolitiqueLoterie::detenteur(long long ticket) const {
+    PRECONDITION(ticket >= 0 && ticket < m_total);
+    size_t position = 0;
+    size_t pas = 1;
+    while (pas * 2 < m_arbre.size()) pas *= 2;
+    for (; pas > 0; pas /= 2) {
+        if (position + pas < m_arbre.size() && m_arbre[position + pas] <= ticket) {
+            position += pas;
+            ticket -= m_arbre[position];
+        }
+    }
+    return static_cast<uint32_t>(position);
+}
+
+const long long PolitiqueStride::ENJAMBEE;
+const int PolitiqueStride::HORS_PROCESSEUR;
+
+/**
+ * \brief Constructeur.
+ * \param[in] table La table des processus.
+ * \param[in] quantum Durée maximale d'une tranche.
+ * \pre quantum > 0
+ */
+PolitiqueStride::PolitiqueStride(const TableProcessus& table, int quantum)
+    : m_table(table), m_quantum(quantum), m_passeGlobale(0),
+      m_etats(std::make_shared<std::vector<Etat>>(table.taille(), Etat{0, HORS_PROCESSEUR})), m_compte(table) {
+    PRECONDITION(quantum > 0);
+    m_prets.reserver(table.taille());
+}
+
+/**
+ * \brief Rend un processus prêt, en O(log n).
+ *
+ *        Au retour d'une tranche, la passe avance du temps consommé fois
+ *        l'enjambée ; une arrivée prend la passe du dernier élu, un réveil
+ *        garde la sienne si elle est plus grande.
+ */
+void PolitiqueStride::ajouter(uint32_t i, int horloge) {
+    Etat& e = (*m_etats)[i];
+    if (e.debut != HORS_PROCESSEUR) {
+        sortir(i, horloge);
+    } else {
+        e.passe = std::max(e.passe, m_passeGlobale);
+    }
+    m_prets.inserer(PretStride{e.passe, i});
+    m_compte.ajouter(i, horloge);
+}
+
+/**
+ * \brief L'élu se bloque : sa passe avance du temps consommé, et ses tickets sortent
+ *        du partage jusqu'à son réveil.
+ */
+void PolitiqueStride::bloquer(uint32_t i, int horloge) {
+    PRECONDITION((*m_etats)[i].debut != HORS_PROCESSEUR);
+    sortir(i, horloge);
+    m_compte.bloquer(i, horloge);
+}
+
+/**
+ * \brief Vérifie si aucun processus n'est prêt.
+ */
+bool PolitiqueStride::estVide() const {
+    return m_prets.estVide();
+}
+
+/**
+ * \brief Retire le processus prêt de plus petite passe, en O(log n).
+ * \pre !estVide()
+ */
+uint32_t PolitiqueStride::extraire(int horloge) {
+    PRECONDITION(!estVide());
+    PretStride elu = m_prets.extraireSommet();
+    m_passeGlobale = elu.passe;
+    (*m_etats)[elu.index].debut = horloge;
+    m_compte.elire(elu.index, horloge);
+    return elu.index;
+}
+
+/**
+ * \brief L'élu s'exécute au plus un quantum.
+ */
+int PolitiqueStride::tranche(uint32_t, int) const {
+    return m_quantum;
+}
+
+/**
+ * \brief Les arrivées attendent la fin de la tranche : jamais d'interruption.
+ */
+bool PolitiqueStride::preempte(uint32_t, int) const {
+    return false;
+}
+
+/**
+ * \brief Parts du processeur par type, cibles et obtenues (voir ComptePartage).
+ */
+PartsParType PolitiqueStride::parts() const {
+    return m_compte.parts();
+}
+
+/**
+ * \brief L'élu quitte le processeur : sa passe avance du temps consommé fois son enjambée.
+ */
+void PolitiqueStride::sortir(uint32_t i, int horloge) {
+    Etat& e = (*m_etats)[i];
+    e.passe += static_cast<long long>(horloge - e.debut) * (ENJAMBEE / tickets(m_table, i));
+    e.debut = HORS_PROCESSEUR;
+}
+
+/**
+ * \brief Poids CFS d'un processus (table sched_prio_to_weight du noyau Linux, nice 0 à −20).
+ * \param[in] table La table des processus.
+ * \param[in] i Indice du processus dans la table.
+ */
+int poidsCfs(const TableProcessus& table, uint32_t i) {
+    static const std::array<int, 21> POIDS = {
+        1024,  1277,  1586,  1991,  2501,  3121,  3906,  4904,  6100,  7620, 9548,
+        11916, 14949, 18705, 23254, 29154, 36291, 46273, 56483, 71755, 88761};
+    return POIDS[static_cast<size_t>(std::min(table.priorites()[i], 20))];
+}
+
+const int PolitiqueCfs::POIDS_REFERENCE;
+const long long PolitiqueCfs::ECHELLE;
+const int PolitiqueCfs::HORS_PROCESSEUR;
+
+/**
+ * \brief Constructeur : arbre vide, temps virtuels nuls.
+ * \param[in] table La table des processus, pour lire leur priorité.
+ * \param[in] latence La latence cible : période au bout de laquelle chaque prêt a été servi.
+ * \param[in] granularite La tranche minimale.
+ * \pre latence > 0, granularite > 0
+ */
+PolitiqueCfs::PolitiqueCfs(const TableProcessus& table, int latence, int granularite)
+    : m_table(table), m_latence(latence), m_granularite(granularite), m_vruntimeMin(0), m_poidsPrets(0),
+      m_rang(0), m_etats(std::make_shared<std::vector<Etat>>(table.taille(), Etat{0, HORS_PROCESSEUR})) {
+    PRECONDITION(latence > 0);
+    PRECONDITION(granularite > 0);
+}
+
+/**
+ * \brief Rend un processus prêt, en O(log n).
+ *
+ *        Au retour d'une tranche, le temps virtuel avance du temps consommé ;
+ *        un arrivant, ou un processus qui revient d'une entrée-sortie, part au
+ *        moins du temps virtuel minimal.
+ */
+void PolitiqueCfs::ajouter(uint32_t i, int horloge) {
+    Etat& e = (*m_etats)[i];
+    if (e.debut != HORS_PROCESSEUR) {
+        sortir(i, horloge);
+    } else {
+        e.vruntime = std::max(e.vruntime, m_vruntimeMin);
+    }
+    m_prets.insert(PretCfs{e.vruntime, m_rang++, i});
+    m_poidsPrets += poidsCfs(m_table, i);
+}
+
+/**
+ * \brief L'élu se bloque : son temps virtuel avance du temps consommé.
+ */
+void PolitiqueCfs::bloquer(uint32_t i, int horloge) {
+    PRECONDITION((*m_etats)[i].debut != HORS_PROCESSEUR);
+    sortir(i, horloge);
+}
+
+/**
+ * \brief Vérifie si aucun processus n'est prêt.
+ */
+bool PolitiqueCfs::estVide() const {
+    return m_prets.empty();
+}
+
+/**
+ * \brief Retire le processus prêt de plus petit temps virtuel, en O(log n).
+ * \pre !estVide()
+ */
+uint32_t PolitiqueCfs::extraire(int horloge) {
+    PRECONDITION(!estVide());
+    PretCfs elu = *m_prets.begin();
+    m_prets.erase(m_prets.begin());
+    m_poidsPrets -= poidsCfs(m_table, elu.index);
+    m_vruntimeMin = std::max(m_vruntimeMin, elu.vruntime);
+    (*m_etats)[elu.index].debut = horloge;
+    return elu.index;
+}
+
+/**
+ * \brief Ce qui reste de la part de l'élu dans la période, selon les prêts actuels.
+ *
+ *        Une arrivée raccourcit ainsi la tranche en cours.
+ */
+int PolitiqueCfs::tranche(uint32_t i, int horloge) const {
+    long long nombre = static_cast<long long>(m_prets.size()) + 1;
+    long long periode = std::max(static_cast<long long>(m_latence), nombre * m_granularite);
+    long long poids = poidsCfs(m_table, i);
+    long long part = std::max(static_cast<long long>(m_granularite), periode * poids / (m_poidsPrets + poids));
+    return static_cast<int>(std::max(0LL, (*m_etats)[i].debut + part - horloge));
+}
+
+/**
+ * \brief Préempte si l'élu a pris plus d'une granularité d'avance sur le plus à gauche.
+ */
+bool PolitiqueCfs::preempte(uint32_t courant, int horloge) const {
+    if (m_prets.empty()) return false;
+    const PretCfs& gauche = *m_prets.begin();
+    const Etat& e = (*m_etats)[courant];
+    long long vruntime = e.vruntime + avance(courant, horloge - e.debut);
+    return vruntime - gauche.vruntime > avance(gauche.index, m_granularite);
+}
+
+/**
+ * \brief Avance du temps virtuel d'un processus qui s'exécute pendant duree.
+ */
+long long PolitiqueCfs::avance(uint32_t i, int duree) const {
+    return static_cast<long long>(duree) * POIDS_REFERENCE * ECHELLE / poidsCfs(m_table, i);
+}
+
+/**
+ * \brief L'élu quitte le processeur : son temps virtuel avance du temps consommé.
+ */
+void PolitiqueCfs::sortir(uint32_t i, int horloge) {
+    Etat& e = (*m_etats)[i];
+    e.vruntime += avance(i, horloge - e.debut);
+    e.debut = HORS_PROCESSEUR;
+}
@@ -0,0 +1,679 @@
+//
+// Created by Vincent on 10/1/2024.
+//
+
+#ifndef POLITIQUES_H
+#define POLITIQUES_H
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+#include "ContratException.h"
+#include "File.h"
+#include "Simulation.h"
+#include "TableProcessus.h"
+#include "TasIndexe.h"
+
+/**
+ * \brief File des prêts FIFO, commune à FCFS et au tourniquet.
+ *
+ *        Les indices sont rangés dans une File contiguë (tampon circulaire) :
+ *        ajout et extraction en O(1) amorti.
+ */
+class FilePrets {
+public:
+  void ajouter(uint32_t i, int horloge);
+  void bloquer(uint32_t i, int horloge);
+  bool estVide() const;
+  uint32_t extraire(int horloge);
+
+private:
+  File<uint32_t, StockageContigu> m_prets;
+};
+
+/**
+ * \brief Politique FCFS : le premier arrivé est servi jusqu'au bout.
+ */
+class PolitiqueFcfs : public FilePrets {
+public:
+  int tranche(uint32_t i, int horloge) const;
+  bool preempte(uint32_t courant, int horloge) const;
+};
+
+/**
+ * \brief Politique du tourniquet : FIFO, chaque élu s'exécute au plus un quantum.
+ *
+ *        Une tranche coûte O(1) : une extraction en tête et, si le processus
+ *        n'a pas terminé, une insertion en queue. Les attentes ne sont pas
+ *        cumulées tranche par tranche ; le moteur les déduit de l'instant de fin.
+ */
+class PolitiqueTourniquet : public FilePrets {
+public:
+  explicit PolitiqueTourniquet(int quantum);
+  int tranche(uint32_t i, int horloge) const;
+  bool preempte(uint32_t courant, int horloge) const;
+
+private:
+  int m_quantum;
+};
+
+/**
+ * \brief Ordre FJS : durée la plus courte d'abord.
+ */
+struct ParDuree {
+  const TableProcessus* table;
+  bool operator()(uint32_t a, uint32_t b) const {
+    return table->durees()[a] < table->durees()[b];
+  }
+};
+
+/**
+ * \brief Ordre par priorité : priorité numérique la plus élevée d'abord.
+ */
+struct ParPriorite {
+  const TableProcessus* table;
+  bool operator()(uint32_t a, uint32_t b) const {
+    return table->priorites()[a] > table->priorites()[b];
+  }
+};
+
+/**
+ * \brief Entrée de la file SRTF : le temps restant est copié à côté de l'indice.
+ *
+ *        Le temps restant d'un processus prêt ne change pas tant qu'il est dans
+ *        la file (seul l'élu s'exécute) ; la copie évite au tas une indirection
+ *        vers la table à chaque comparaison.
+ */
+struct PretSrtf {
+  int restant;
+  uint32_t index;
+};
+
+/**
+ * \brief Ordre SRTF : temps restant le plus court d'abord.
+ */
+struct ParRestant {
+  bool operator()(const PretSrtf& a, const PretSrtf& b) const {
+    return a.restant < b.restant;
+  }
+};
+
+/**
+ * \brief Politique non préemptive dont la file des prêts est un tas indexé.
+ *
+ *        Parmi les processus prêts, l'élu est le sommet du tas selon Comparateur ;
+ *        le tas étant stable, l'ordre d'arrivée départage les égalités. Sert à FJS
+ *        (ParDuree) et à la priorité (ParPriorite).
+ *
+ * \tparam Comparateur Ordre sur les indices de la table, construit à partir d'un pointeur vers celle-ci.
+ */
+template <typename Comparateur>
+class PolitiqueTas {
+public:
+  explicit PolitiqueTas(const TableProcessus& table);
+
+  void ajouter(uint32_t i, int horloge);
+  void bloquer(uint32_t i, int horloge);
+  bool estVide() const;
+  uint32_t extraire(int horloge);
+  int tranche(uint32_t i, int horloge) const;
+  bool preempte(uint32_t courant, int horloge) const;
+
+private:
+  TasIndexe<uint32_t, Comparateur> m_prets;
+};
+
+/**
+ * \brief Politique SRTF (Shortest Remaining Time First), préemptive.
+ *
+ *        Les processus prêts sont rangés dans un tas indexé selon leur temps
+ *        restant. À chaque arrivée, le processus courant est interrompu si un
+ *        processus prêt a un temps restant strictement plus court ; à égalité,
+ *        le courant garde le processeur. Minimise le temps d'attente moyen : sert
+ *        de borne inférieure aux autres politiques. O(n log n) au total, puisqu'il
+ *        y a au plus une préemption par arrivée.
+ */
+class PolitiqueSrtf {
+public:
+  explicit PolitiqueSrtf(const TableProcessus& table);
+
+  void ajouter(uint32_t i, int horloge);
+  void bloquer(uint32_t i, int horloge);
+  bool estVide() const;
+  uint32_t extraire(int horloge);
+  int tranche(uint32_t i, int horloge) const;
+  bool preempte(uint32_t courant, int horloge) const;
+
+private:
+  const TableProcessus& m_table;
+  TasIndexe<PretSrtf, ParRestant> m_prets;
+};
+
+/**
+ * \brief Entrée de la file EDF : échéance (clé) et indice.
+ */
+struct PretEdf {
+  long long echeance;
+  uint32_t index;
+};
+
+/**
+ * \brief Ordre EDF : échéance la plus proche d'abord.
+ */
+struct ParEcheance {
+  bool operator()(const PretEdf& a, const PretEdf& b) const {
+    return a.echeance < b.echeance;
+  }
+};
+
+/**
+ * \brief Politique EDF (Earliest Deadline First), préemptive.
+ *
+ *        L'élu est le processus prêt dont l'échéance est la plus proche ; une
+ *        arrivée à échéance strictement plus proche interrompt le processus
+ *        courant. Les processus sans échéance passent après tous les autres, dans
+ *        l'ordre où ils sont redevenus prêts. Sur un processeur, EDF respecte toutes les échéances
+ *        dès qu'un ordonnancement le peut : une échéance manquée signale une
+ *        charge infaisable. Les prêts sont dans un tas indexé : O(log n) par
+ *        opération, au plus une préemption par arrivée.
+ */
+class PolitiqueEdf {
+public:
+  explicit PolitiqueEdf(const TableProcessus& table);
+
+  void ajouter(uint32_t i, int horloge);
+  void bloquer(uint32_t i, int horloge);
+  bool estVide() const;
+  uint32_t extraire(int horloge);
+  int tranche(uint32_t i, int horloge) const;
+  bool preempte(uint32_t courant, int horloge) const;
+
+private:
+  const TableProcessus& m_table;
+  TasIndexe<PretEdf, ParEcheance> m_prets;
+
+  long long cle(uint32_t i) const;
+};
+
+/**
+ * \brief Entrée de la file à vieillissement : clé de priorité et indice.
+ *
+ *        cle = priorité × période + attente cumulée − instant d'entrée dans la
+ *        file. La priorité effective à l'instant t vaut (t + cle) / période
+ *        (division entière) : elle croît d'un niveau par période d'attente, et le
+ *        même terme t s'ajoute à toutes les entrées. L'ordre des clés reste donc
+ *        celui des priorités effectives, sans jamais réécrire le tas.
+ */
+struct PretVieilli {
+  long long cle;
+  uint32_t index;
+};
+
+/**
+ * \brief Ordre à vieillissement : clé la plus élevée d'abord.
+ */
+struct ParCle {
+  bool operator()(const PretVieilli& a, const PretVieilli& b) const {
+    return a.cle > b.cle;
+  }
+};
+
+/**
+ * \brief Politique par priorité préemptive, avec vieillissement.
+ *
+ *        La priorité effective d'un processus monte d'un niveau par période
+ *        d'attente cumulée depuis son arrivée ; elle est figée pendant qu'il
+ *        s'exécute. L'élu est préempté dès qu'un processus prêt le dépasse
+ *        strictement, à une arrivée ou par vieillissement. Un processus qui a
+ *        attendu g périodes dépasse donc tout processus de g niveaux de plus
+ *        n'ayant jamais attendu : l'attente maximale est bornée.
+ *
+ *        Le vieillissement de toute la file est implicite (voir PretVieilli) :
+ *        chaque opération coûte O(log n). L'attente cumulée de chaque processus
+ *        est partagée entre les copies de la politique (une par cœur dans
+ *        SimulationMulticoeur.h) : un processus la garde en migrant.
+ */
+class PolitiquePrioriteVieillissement {
+public:
+  PolitiquePrioriteVieillissement(const TableProcessus& table, int periode);
+
+  void ajouter(uint32_t i, int horloge);
+  void bloquer(uint32_t i, int horloge);
+  bool estVide() const;
+  uint32_t extraire(int horloge);
+  int tranche(uint32_t i, int horloge) const;
+  bool preempte(uint32_t courant, int horloge) const;
+
+private:
+  const TableProcessus& m_table;
+  long long m_periode;
+  TasIndexe<PretVieilli, ParCle> m_prets;
+  std::shared_ptr<std::vector<int>> m_attente;
+
+  long long effective(long long cle, int horloge) const;
+  long long effectiveElu(uint32_t i) const;
+};
+
+/**
+ * \brief Politique multiniveaux : une file par type de processus.
+ *
+ *        Les niveaux sont servis par importance décroissante (SYSTEME,
+ *        INTERACTIF, BATCH, UTILISATEUR) : un processus ne s'exécute que si les
+ *        niveaux supérieurs sont vides, et l'arrivée d'un processus d'un niveau
+ *        supérieur interrompt le processus courant. Les processus système sont
+ *        servis par priorité, les interactifs en tourniquet, les autres en FIFO.
+ */
+class PolitiqueMultiniveaux {
+public:
+  PolitiqueMultiniveaux(const TableProcessus& table, int quantum);
+
+  void ajouter(uint32_t i, int horloge);
+  void bloquer(uint32_t i, int horloge);
+  bool estVide() const;
+  uint32_t extraire(int horloge);
+  int tranche(uint32_t i, int horloge) const;
+  bool preempte(uint32_t courant, int horloge) const;
+
+private:
+  const TableProcessus& m_table;
+  PolitiqueTas<ParPriorite> m_systeme;
+  PolitiqueTourniquet m_interactif;
+  PolitiqueFcfs m_batch;
+  PolitiqueFcfs m_utilisateur;
+
+  int niveauPrets() const;
+};
+
+
+/**
+ * \brief Politique MLFQ (Multi-Level Feedback Queue) configurable.
+ *
+ *        N niveaux FIFO, du plus important (0) au moins important (N - 1), chacun
+ *        avec son quantum. Un processus entre au niveau de son type (SYSTEME au
+ *        niveau 0, INTERACTIF au 1, et ainsi de suite, borné par N - 1). Quand
+ *        il a consommé le quantum de son niveau, en une ou plusieurs tranches,
+ *        il descend d'un niveau. Toutes les periodeRelevement unités de temps,
+ *        tous les processus remontent au niveau 0, ce qui évite la famine des
+ *        niveaux bas, y compris des types qui y entrent. Un processus qui se
+ *        bloque pour une entrée-sortie avant d'avoir épuisé son quantum garde
+ *        son niveau : les processus interactifs restent en haut.
+ *
+ *        Un niveau n'est servi que si les niveaux supérieurs sont vides, et une
+ *        arrivée à un niveau supérieur interrompt le processus courant, sans
+ *        lui faire perdre le quantum déjà consommé. Les niveaux non vides sont
+ *        notés dans un masque de bits : le choix du niveau coûte O(1). Un
+ *        relèvement concatène les files chaînées en O(N) ; le niveau et le
+ *        quantum consommé de chaque processus sont remis à zéro paresseusement,
+ *        par numéro d'époque. Cet état est partagé entre les copies de la
+ *        politique : un processus garde son niveau en changeant de cœur.
+ */
+class PolitiqueMlfq {
+public:
+  static const size_t NIVEAUX_MAX = 64;
+
+  PolitiqueMlfq(const TableProcessus& table, const std::vector<int>& quanta, int periodeRelevement);
+
+  void ajouter(uint32_t i, int horloge);
+  void bloquer(uint32_t i, int horloge);
+  bool estVide() const;
+  uint32_t extraire(int horloge);
+  int tranche(uint32_t i, int horloge) const;
+  bool preempte(uint32_t courant, int horloge) const;
+
+  int niveau(uint32_t i) const;
+
+private:
+  static const int HORS_PROCESSEUR = -1;
+  static const int BLOQUE = -2;
+
+  /**
+   * \brief État d'un processus ; niveau et consomme ne valent que si epoque est l'époque courante.
+   */
+  struct Etat {
+    int epoque;
+    int niveau;
+    int consomme;
+    int debut;
+  };
+
+  const TableProcessus& m_table;
+  std::vector<int> m_quanta;
+  int m_periodeRelevement;
+  int m_prochainRelevement;
+  int m_epoque;
+  std::vector<File<uint32_t>> m_niveaux;
+  uint64_t m_nonVides;
+  std::shared_ptr<std::vector<Etat>> m_etats;
+
+  Etat& etat(uint32_t i);
+  const Etat& etat(uint32_t i) const;
+  int niveauInitial(uint32_t i) const;
+  int niveauPrets() const;
+  int debutComptage(const Etat& e) const;
+  void sortir(Etat& e, int horloge);
+  void relever(int horloge);
+};
+
+/**
+ * \brief Part du processeur par type de processus, cible et obtenue.
+ *
+ *        Indicées par type - SYSTEME. Seuls comptent les instants où des processus
+ *        d'au moins deux types sont prêts ou en exécution : un type seul prend
+ *        tout le processeur quelle que soit la politique. La part cible d'un
+ *        type est, instant par instant, la part de ses tickets parmi ceux des
+ *        processus prêts ou en exécution ; la part obtenue est la part du temps
+ *        où il s'est exécuté. Les deux sont cumulées sur ces instants, puis
+ *        normalisées (somme 1, ou 0 sans concurrence).
+ *
+ *        retardMax est, pour chaque type, le plus grand écart relevé à un
+ *        événement entre son temps cible cumulé et son temps obtenu cumulé, en
+ *        unités de temps : il reste de l'ordre du quantum pour une politique qui
+ *        respecte les tickets à tout moment, et grandit avec la durée sinon.
+ */
+struct PartsParType {
+  static const size_t TYPES = 4;
+
+  std::array<double, TYPES> cible;
+  std::array<double, TYPES> obtenue;
+  std::array<double, TYPES> retardMax;
+
+  std::string toString() const;
+};
+
+/**
+ * \brief Nombre de tickets d'un processus : sa priorité plus un, au moins un.
+ */
+int tickets(const TableProcessus& table, uint32_t i);
+
+/**
+ * \brief Comptabilité des parts cible et obtenue d'une politique à partage proportionnel.
+ *
+ *        La politique signale chaque processus qui devient prêt (arrivée, réveil ou
+ *        retour après une tranche), chaque élection et chaque blocage ; un élu
+ *        dont le temps restant est nul à l'événement suivant a terminé à sa fin.
+ *        Un processus terminé ou bloqué sort de l'ensemble des processus actifs. Le suivi suppose un seul processeur : avec
+ *        plusieurs cœurs (SimulationMulticoeur.h), chaque copie de la politique
+ *        ne mesure correctement que ce qu'elle élit pour un cœur à la fois.
+ */
+class ComptePartage {
+public:
+  explicit ComptePartage(const TableProcessus& table);
+
+  void ajouter(uint32_t i, int horloge);
+  void bloquer(uint32_t i, int horloge);
+  void elire(uint32_t i, int horloge);
+
+  PartsParType parts() const;
+
+private:
+  static const uint32_t AUCUN = static_cast<uint32_t>(-1);
+
+  const TableProcessus* m_table;
+  int m_instant;
+  uint32_t m_elu;
+  long long m_total;
+  std::array<long long, PartsParType::TYPES> m_tickets;
+  std::array<double, PartsParType::TYPES> m_cible;
+  std::array<double, PartsParType::TYPES> m_obtenu;
+  std::array<double, PartsParType::TYPES> m_retard;
+  std::array<double, PartsParType::TYPES> m_retardMax;
+  std::vector<bool> m_actifs;
+
+  size_t type(uint32_t i) const;
+  void avancer(int horloge);
+  void suivre(int horloge);
+};
+
+/**
+ * \brief Politique par loterie : à chaque élection, un ticket est tiré au hasard parmi
+ *        ceux des processus prêts, et son détenteur s'exécute au plus un quantum.
+ *
+ *        Un processus prêt détient tickets() tickets ; sur la durée, sa part du
+ *        processeur est proportionnelle à ce nombre. Les tickets sont rangés dans
+ *        un arbre de Fenwick indexé par processus : ajout, retrait et recherche
+ *        du détenteur du r-ième ticket coûtent O(log n). Le générateur est
+ *        initialisé par une graine : une simulation est reproductible.
+ */
+class PolitiqueLoterie {
+public:
+  PolitiqueLoterie(const TableProcessus& table, int quantum, unsigned graine);
+
+  void ajouter(uint32_t i, int horloge);
+  void bloquer(uint32_t i, int horloge);
+  bool estVide() const;
+  uint32_t extraire(int horloge);
+  int tranche(uint32_t i, int horloge) const;
+  bool preempte(uint32_t courant, int horloge) const;
+
+  PartsParType parts() const;
+
+private:
+  const TableProcessus& m_table;
+  int m_quantum;
+  std::mt19937_64 m_generateur;
+  std::vector<long long> m_arbre;
+  long long m_total;
+  ComptePartage m_compte;
+
+  void modifier(uint32_t i, long long delta);
+  uint32_t detenteur(long long ticket) const;
+};
+
+/**
+ * \brief Entrée de la file du partage par enjambées : passe et indice.
+ */
+struct PretStride {
+  long long passe;
+  uint32_t index;
+};
+
+/**
+ * \brief Ordre du partage par enjambées : plus petite passe d'abord.
+ */
+struct ParPasse {
+  bool operator()(const PretStride& a, const PretStride& b) const {
+    return a.passe < b.passe;
+  }
+};
+
+/**
+ * \brief Politique de partage par enjambées (stride scheduling), déterministe.
+ *
+ *        Chaque processus a une passe ; l'élu est celui dont la passe est la plus
+ *        petite, et il s'exécute au plus un quantum. Sa passe avance ensuite du
+ *        temps consommé multiplié par son enjambée, ENJAMBEE / tickets() : un
+ *        processus qui a deux fois plus de tickets avance deux fois moins vite et
+ *        s'exécute deux fois plus souvent. Un arrivant prend la passe du dernier
+ *        élu, pour ne pas rattraper à lui seul le temps où il était absent ; de
+ *        même, un processus qui revient d'une entrée-sortie ne garde sa passe
+ *        que si elle est en avance. Les
+ *        prêts sont dans un tas indexé : O(log n) par élection. La passe de
+ *        chaque processus est partagée entre les copies de la politique (une
+ *        par cœur dans SimulationMulticoeur.h) : un processus la garde en migrant.
+ */
+class PolitiqueStride {
+public:
+  static const long long ENJAMBEE = 1 << 20;
+
+  PolitiqueStride(const TableProcessus& table, int quantum);
+
+  void ajouter(uint32_t i, int horloge);
+  void bloquer(uint32_t i, int horloge);
+  bool estVide() const;
+  uint32_t extraire(int horloge);
+  int tranche(uint32_t i, int horloge) const;
+  bool preempte(uint32_t courant, int horloge) const;
+
+  PartsParType parts() const;
+
+private:
+  static const int HORS_PROCESSEUR = -1;
+
+  /**
+   * \brief État d'un processus : sa passe, et le début de sa tranche s'il est élu.
+   */
+  struct Etat {
+    long long passe;
+    int debut;
+  };
+
+  const TableProcessus& m_table;
+  int m_quantum;
+  long long m_passeGlobale;
+  TasIndexe<PretStride, ParPasse> m_prets;
+  std::shared_ptr<std::vector<Etat>> m_etats;
+  ComptePartage m_compte;
+
+  void sortir(uint32_t i, int horloge);
+};
+
+/**
+ * \brief Poids CFS d'un processus, celui du noyau Linux pour le niveau nice −priorité.
+ *
+ *        Une priorité 0 donne le poids de référence, 1024 (nice 0) ; chaque cran
+ *        de priorité multiplie le poids par environ 1,25, jusqu'à nice −20 pour
+ *        une priorité de 20 ou plus.
+ */
+int poidsCfs(const TableProcessus& table, uint32_t i);
+
+/**
+ * \brief Entrée de l'arbre CFS : temps virtuel (clé), rang d'insertion et indice.
+ */
+struct PretCfs {
+  long long vruntime;
+  uint64_t rang;
+  uint32_t index;
+};
+
+/**
+ * \brief Ordre CFS : plus petit temps virtuel d'abord, puis premier inséré.
+ */
+struct ParVruntime {
+  bool operator()(const PretCfs& a, const PretCfs& b) const {
+    return a.vruntime != b.vruntime ? a.vruntime < b.vruntime : a.rang < b.rang;
+  }
+};
+
+/**
+ * \brief Politique CFS (Completely Fair Scheduler), à la manière de Linux.
+ *
+ *        Chaque processus a un temps virtuel, qui avance du temps d'exécution
+ *        multiplié par POIDS_REFERENCE / poidsCfs() : plus un processus est
+ *        prioritaire, plus son temps virtuel avance lentement. Les prêts sont
+ *        dans un arbre ordonné (arbre rouge-noir de std::set) par temps virtuel ;
+ *        l'élu est le plus à gauche, en O(log n).
+ *
+ *        La période d'ordonnancement vaut la latence cible, allongée à
+ *        granularite × (nombre de processus prêts ou élu) quand ils sont trop
+ *        nombreux ; l'élu en reçoit une part proportionnelle à son poids, jamais
+ *        moins de granularite, comptée depuis son élection : une commutation
+ *        (voir simuler()) est prise sur cette part. Une arrivée interrompt l'élu si son temps virtuel
+ *        courant dépasse de plus d'une granularité (pondérée par le poids de
+ *        l'arrivant) celui du plus à gauche. Un arrivant, comme un processus qui
+ *        revient d'une entrée-sortie, part au moins du temps virtuel minimal,
+ *        pour ne pas rattraper à lui seul le temps où il était absent.
+ *
+ *        Les temps virtuels sont en unités de temps × ECHELLE, pour que la
+ *        division par le poids ne perde rien aux petites durées. Le temps
+ *        virtuel de chaque processus est partagé entre les copies de la
+ *        politique : un processus le garde en changeant de cœur.
+ */
+class PolitiqueCfs {
+public:
+  static const int POIDS_REFERENCE = 1024;
+  static const long long ECHELLE = 1 << 20;
+
+  PolitiqueCfs(const TableProcessus& table, int latence, int granularite);
+
+  void ajouter(uint32_t i, int horloge);
+  void bloquer(uint32_t i, int horloge);
+  bool estVide() const;
+  uint32_t extraire(int horloge);
+  int tranche(uint32_t i, int horloge) const;
+  bool preempte(uint32_t courant, int horloge) const;
+
+private:
+  static const int HORS_PROCESSEUR = -1;
+
+  /**
+   * \brief État d'un processus : son temps virtuel, et le début de sa tranche s'il est élu.
+   */
+  struct Etat {
+    long long vruntime;
+    int debut;
+  };
+
+  const TableProcessus& m_table;
+  int m_latence;
+  int m_granularite;
+  long long m_vruntimeMin;
+  long long m_poidsPrets;
+  uint64_t m_rang;
+  std::set<PretCfs, ParVruntime> m_prets;
+  std::shared_ptr<std::vector<Etat>> m_etats;
+
+  long long avance(uint32_t i, int duree) const;
+  void sortir(uint32_t i, int horloge);
+};
+
+/**
+ * \brief Constructeur : tas vide, dimensionné pour toute la table.
+ * \param[in] table La table dont le comparateur lit les colonnes.
+ */
+template <typename Comparateur>
+PolitiqueTas<Comparateur>::PolitiqueTas(const TableProcessus& table) : m_prets(Comparateur{&table}) {
+  m_prets.reserver(table.taille());
+}
+
+/**
+ * \brief Rend un processus prêt, en O(log n).
+ */
+template <typename Comparateur>
+void PolitiqueTas<Comparateur>::ajouter(uint32_t i, int) {
+  m_prets.inserer(i);
+}
+
+/**
+ * \brief Un processus qui se bloque n'a rien à laisser dans le tas : il reviendra par ajouter().
+ */
+template <typename Comparateur>
+void PolitiqueTas<Comparateur>::bloquer(uint32_t, int) {
+}
+
+/**
+ * \brief Vérifie si aucun processus n'est prêt.
+ */
+template <typename Comparateur>
+bool PolitiqueTas<Comparateur>::estVide() const {
+  return m_prets.estVide();
+}
+
+/**
+ * \brief Retire le prochain élu, en O(log n).
+ * \pre !estVide()
+ */
+template <typename Comparateur>
+uint32_t PolitiqueTas<Comparateur>::extraire(int) {
+  return m_prets.extraireSommet();
+}
+
+/**
+ * \brief L'élu s'exécute jusqu'au bout.
+ */
+template <typename Comparateur>
+int PolitiqueTas<Comparateur>::tranche(uint32_t, int) const {
+  return TRANCHE_ILLIMITEE;
+}
+
+/**
+ * \brief Politique non préemptive : jamais d'interruption.
+ */
+template <typename Comparateur>
+bool PolitiqueTas<Comparateur>::preempte(uint32_t, int) const {
+  return false;
+}
+
+#endif //POLITIQUES_H
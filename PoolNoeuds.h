@@ -0,0 +1,240 @@
+//
+// Created by Vincent on 10/1/2024.
+//
+
+#ifndef POOLNOEUDS_H
+#define POOLNOEUDS_H
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief Politique d'allocation de noeuds passant directement par new et delete.
+ *
+ *        Une politique d'allocation fournit deux fonctions statiques :
+ *        construire<N>(args...) qui retourne un N* construit, et detruire(N*).
+ */
+struct AllocateurStandard {
+  template <typename N, typename... Args>
+  static N* construire(Args&&... args) {
+    return new N(std::forward<Args>(args)...);
+  }
+
+  template <typename N>
+  static void detruire(N* noeud) {
+    delete noeud;
+  }
+};
+
+/**
+ * \brief Réserve de blocs de taille fixe, découpés dans des dalles (slabs).
+ *
+ *        Chaque fil d'exécution a son propriétaire : une liste de blocs libres,
+ *        qu'il est seul à parcourir, sans verrou. Chaque bloc connaît le
+ *        propriétaire du fil qui a découpé sa dalle (un pointeur devant les
+ *        données) et lui revient toujours : un bloc rendu par un autre fil est
+ *        empilé, sans verrou, sur la pile des blocs rendus de son propriétaire,
+ *        qui la reprend d'un coup quand sa liste libre est vide. Un fil qui
+ *        reçoit les résultats d'un pool de fils (voir PoolTaches) rend ainsi
+ *        leurs blocs aux fils qui les réutiliseront.
+ *
+ *        Quand un fil se termine, son propriétaire devient orphelin ; le
+ *        prochain fil qui alloue l'adopte, avec ses blocs libres et rendus.
+ *        Seules l'adoption et la création d'une dalle prennent un verrou
+ *        global. Dalles et propriétaires ne sont jamais rendus au système avant
+ *        la fin du programme : un bloc peut être rendu à tout moment, y compris
+ *        par une file globale détruite après la fin de son fil.
+ *
+ * \tparam Taille Taille d'un bloc en octets.
+ * \tparam Alignement Alignement requis pour un bloc.
+ */
+template <std::size_t Taille, std::size_t Alignement>
+class ReserveBlocs {
+public:
+  static void* prendre();
+  static void rendre(void* bloc);
+
+private:
+  struct Proprietaire;
+
+  struct Bloc {
+    Proprietaire* proprietaire;
+    union {
+      Bloc* suivant;
+      typename std::aligned_storage<Taille, Alignement>::type donnees;
+    };
+  };
+
+  struct Proprietaire {
+    Bloc* libres;                  // Parcourue par le seul fil propriétaire.
+    std::atomic<Bloc*> rendus;     // Pile des blocs rendus par les autres fils.
+
+    Proprietaire() : libres(nullptr), rendus(nullptr) {
+    }
+  };
+
+  /**
+   * \brief Rend le propriétaire du fil aux orphelins quand le fil se termine.
+   */
+  struct Liberation {
+    ~Liberation();
+  };
+
+  static const std::size_t BLOCS_PAR_DALLE = (16384 / sizeof(Bloc)) > 64 ? (16384 / sizeof(Bloc)) : 64;
+
+  static Proprietaire* courant();
+  static Bloc* nouvelleDalle(Proprietaire* proprietaire);
+  static std::mutex& verrou();
+  static std::vector<Proprietaire*>& orphelins();
+
+  static thread_local Proprietaire* s_courant;
+  static thread_local bool s_termine;
+};
+
+template <std::size_t Taille, std::size_t Alignement>
+thread_local typename ReserveBlocs<Taille, Alignement>::Proprietaire* ReserveBlocs<Taille, Alignement>::s_courant =
+    nullptr;
+
+template <std::size_t Taille, std::size_t Alignement>
+thread_local bool ReserveBlocs<Taille, Alignement>::s_termine = false;
+
+/**
+ * \brief Prend un bloc libre du fil courant, en reprenant d'abord les blocs que
+ *        d'autres fils lui ont rendus, puis en créant une nouvelle dalle.
+ * \return Un bloc non initialisé de Taille octets.
+ */
+template <std::size_t Taille, std::size_t Alignement>
+void* ReserveBlocs<Taille, Alignement>::prendre() {
+  Proprietaire* p = courant();
+  if (p->libres == nullptr) p->libres = p->rendus.exchange(nullptr, std::memory_order_acquire);
+  if (p->libres == nullptr) p->libres = nouvelleDalle(p);
+  Bloc* bloc = p->libres;
+  p->libres = bloc->suivant;
+  return &bloc->donnees;
+}
+
+/**
+ * \brief Rend un bloc à son propriétaire : dans sa liste libre si c'est le fil
+ *        courant, sinon sur sa pile des blocs rendus.
+ * \param[in] bloc Bloc obtenu par prendre(), dans n'importe quel fil.
+ */
+template <std::size_t Taille, std::size_t Alignement>
+void ReserveBlocs<Taille, Alignement>::rendre(void* bloc) {
+  Bloc* b = reinterpret_cast<Bloc*>(static_cast<char*>(bloc) - offsetof(Bloc, donnees));
+  Proprietaire* p = b->proprietaire;
+  if (p == s_courant) {
+    b->suivant = p->libres;
+    p->libres = b;
+    return;
+  }
+  Bloc* tete = p->rendus.load(std::memory_order_relaxed);
+  do {
+    b->suivant = tete;
+  } while (!p->rendus.compare_exchange_weak(tete, b, std::memory_order_release, std::memory_order_relaxed));
+}
+
+/**
+ * \brief Propriétaire du fil courant, adopté parmi les orphelins ou créé au premier appel.
+ */
+template <std::size_t Taille, std::size_t Alignement>
+typename ReserveBlocs<Taille, Alignement>::Proprietaire* ReserveBlocs<Taille, Alignement>::courant() {
+  if (s_courant != nullptr) return s_courant;
+  {
+    std::lock_guard<std::mutex> garde(verrou());
+    if (orphelins().empty()) {
+      s_courant = new Proprietaire;
+    } else {
+      s_courant = orphelins().back();
+      orphelins().pop_back();
+    }
+  }
+  if (!s_termine) {
+    static thread_local Liberation liberation;
+    (void) liberation;
+  }
+  return s_courant;
+}
+
+/**
+ * \brief Le fil se termine : son propriétaire, ses blocs libres compris, attend un autre fil.
+ */
+template <std::size_t Taille, std::size_t Alignement>
+ReserveBlocs<Taille, Alignement>::Liberation::~Liberation() {
+  std::lock_guard<std::mutex> garde(verrou());
+  orphelins().push_back(s_courant);
+  s_courant = nullptr;
+  s_termine = true;
+}
+
+/**
+ * \brief Alloue une dalle pour un propriétaire et chaîne ses blocs.
+ * \return Le premier bloc de la nouvelle dalle.
+ *
+ * La dalle est inscrite dans un registre qui n'est jamais détruit, pour que les
+ * files globales détruites en fin de programme puissent encore rendre leurs blocs.
+ */
+template <std::size_t Taille, std::size_t Alignement>
+typename ReserveBlocs<Taille, Alignement>::Bloc* ReserveBlocs<Taille, Alignement>::nouvelleDalle(
+    Proprietaire* proprietaire) {
+  static std::vector<Bloc*>* dalles = new std::vector<Bloc*>;
+
+  Bloc* dalle = new Bloc[BLOCS_PAR_DALLE];
+  {
+    std::lock_guard<std::mutex> garde(verrou());
+    dalles->push_back(dalle);
+  }
+  for (std::size_t i = 0; i < BLOCS_PAR_DALLE; ++i) {
+    dalle[i].proprietaire = proprietaire;
+    dalle[i].suivant = i + 1 < BLOCS_PAR_DALLE ? &dalle[i + 1] : nullptr;
+  }
+  return dalle;
+}
+
+/**
+ * \brief Verrou global de la réserve, jamais détruit.
+ */
+template <std::size_t Taille, std::size_t Alignement>
+std::mutex& ReserveBlocs<Taille, Alignement>::verrou() {
+  static std::mutex* verrou = new std::mutex;
+  return *verrou;
+}
+
+/**
+ * \brief Propriétaires des fils terminés, en attente d'adoption ; jamais détruit.
+ */
+template <std::size_t Taille, std::size_t Alignement>
+std::vector<typename ReserveBlocs<Taille, Alignement>::Proprietaire*>& ReserveBlocs<Taille, Alignement>::orphelins() {
+  static std::vector<Proprietaire*>* orphelins = new std::vector<Proprietaire*>;
+  return *orphelins;
+}
+
+/**
+ * \brief Politique d'allocation par défaut des files : réserve de noeuds recyclés.
+ *
+ *        Après la montée en charge, insérer et supprimer dans une File ne fait
+ *        plus aucun appel à l'allocateur du système.
+ */
+struct PoolNoeuds {
+  template <typename N, typename... Args>
+  static N* construire(Args&&... args) {
+    void* bloc = ReserveBlocs<sizeof(N), alignof(N)>::prendre();
+    try {
+      return new (bloc) N(std::forward<Args>(args)...);
+    } catch (...) {
+      ReserveBlocs<sizeof(N), alignof(N)>::rendre(bloc);
+      throw;
+    }
+  }
+
+  template <typename N>
+  static void detruire(N* noeud) {
+    noeud->~N();
+    ReserveBlocs<sizeof(N), alignof(N)>::rendre(noeud);
+  }
+};
+
+#endif //POOLNOEUDS_H
@@ -0,0 +1,50 @@
+#include "PoolTaches.h"
+#include <utility>
+
+/**
+ * \brief Constructeur : démarre les fils de travail.
+ * \param[in] fils Nombre de fils ; 0 est ramené à 1.
+ */
+PoolTaches::PoolTaches(size_t fils) : m_arret(false) {
+    if (fils == 0) fils = 1;
+    m_fils.reserve(fils);
+    for (size_t i = 0; i < fils; ++i) {
+        m_fils.emplace_back([this]() { travailler(); });
+    }
+}
+
+/**
+ * \brief Destructeur : attend que les tâches soumises soient terminées, puis arrête les fils.
+ */
+PoolTaches::~PoolTaches() {
+    {
+        std::lock_guard<std::mutex> garde(m_verrou);
+        m_arret = true;
+    }
+    m_condition.notify_all();
+    for (std::thread& fil : m_fils) fil.join();
+}
+
+/**
+ * \brief Nombre de fils de travail.
+ */
+size_t PoolTaches::taille() const {
+    return m_fils.size();
+}
+
+/**
+ * \brief Boucle d'un fil de travail : prend la tâche en tête de file et l'exécute hors du verrou.
+ */
+void PoolTaches::travailler() {
+    while (true) {
+        std::function<void()> tache;
+        {
+            std::unique_lock<std::mutex> verrou(m_verrou);
+            m_condition.wait(verrou, [this]() { return m_arret || !m_taches.estVide(); });
+            if (m_taches.estVide()) return;
+            tache = std::move(m_taches.getValeur(0));
+            m_taches.supprimerPremier();
+        }
+        tache();
+    }
+}
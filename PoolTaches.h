@@ -0,0 +1,80 @@
+//
+// Created by Vincent on 10/1/2024.
+//
+
+#ifndef POOLTACHES_H
+#define POOLTACHES_H
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "ContratException.h"
+#include "File.h"
+
+/**
+ * \class PoolTaches
+ * \brief Ensemble fixe de fils d'exécution qui se partagent une file de tâches.
+ *
+ *        soumettre() range une tâche dans la file et retourne un std::future sur
+ *        son résultat ; une exception levée par la tâche est transmise par ce
+ *        future. Les tâches démarrent dans l'ordre de soumission, mais se
+ *        terminent dans n'importe quel ordre : pour un affichage déterministe,
+ *        lire les futures dans l'ordre où ils ont été obtenus.
+ *
+ *        La file est une File protégée par un verrou (les consommateurs sont
+ *        multiples, FileConcurrente ne convient donc pas). Ses noeuds passent
+ *        par AllocateurStandard : chaque noeud est pris par le fil qui soumet
+ *        et rendu par un fil de travail, et PoolNoeuds ferait de chaque rendu
+ *        un échange atomique sur la pile du fil qui soumet, en plus du verrou.
+ *
+ *        Le destructeur laisse les fils terminer les tâches déjà soumises.
+ */
+class PoolTaches {
+public:
+    explicit PoolTaches(size_t fils);
+    ~PoolTaches();
+
+    PoolTaches(const PoolTaches&) = delete;
+    PoolTaches& operator=(const PoolTaches&) = delete;
+
+    template <typename Tache>
+    std::future<typename std::result_of<Tache()>::type> soumettre(Tache tache);
+
+    size_t taille() const;
+
+private:
+    std::vector<std::thread> m_fils;
+    File<std::function<void()>, StockageChaine, AllocateurStandard> m_taches;
+    std::mutex m_verrou;
+    std::condition_variable m_condition;
+    bool m_arret;
+
+    void travailler();
+};
+
+/**
+ * \brief Soumet une tâche au pool.
+ * \param[in] tache Un appelable sans argument ; il est déplacé dans la file.
+ * \return Le future qui recevra le résultat de la tâche, ou son exception.
+ */
+template <typename Tache>
+std::future<typename std::result_of<Tache()>::type> PoolTaches::soumettre(Tache tache) {
+    typedef typename std::result_of<Tache()>::type Resultat;
+    // std::function exige un appelable copiable : la packaged_task est partagée.
+    auto emballee = std::make_shared<std::packaged_task<Resultat()>>(std::move(tache));
+    std::future<Resultat> resultat = emballee->get_future();
+    {
+        std::lock_guard<std::mutex> garde(m_verrou);
+        PRECONDITION(!m_arret);
+        m_taches.insererDernier(std::function<void()>([emballee]() { (*emballee)(); }));
+    }
+    m_condition.notify_one();
+    return resultat;
+}
+
+#endif //POOLTACHES_H
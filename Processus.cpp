@@ -1,23 +1,50 @@
 #include "Processus.h"
+#include <algorithm>
 #include "ContratException.h"
+#include "TableIdentifiants.h"
+#include "TableRafales.h"
+
+const int Processus::AUCUNE_ECHEANCE;
 
 /**
  * \brief Constructeur de la classe Processus
- * \param[in] p_pid Identifiant unique du processus.
+ * \param[in] p_pid Identifiant unique du processus, interné dans la table globale.
  * \param[in] p_arrivee Temps d'arrivée du processus dans le système.
  * \param[in] p_duree Durée totale d'exécution du processus.
  * \param[in] p_priorite Priorité du processus (un entier plus bas signifie une priorité plus haute).
  * \param[in] p_type Type du processus (SYSTEME, INTERACTIF, BATCH, UTILISATEUR).
- * \pre p_arrivee >= 0, p_duree > 0, p_priorite >= 0
+ * \param[in] p_echeance Instant avant lequel le processus devrait avoir fini, ou AUCUNE_ECHEANCE.
+ * \pre p_pid != "", p_arrivee >= 0, p_duree > 0, p_priorite >= 0
+ * \pre p_echeance >= 0 ou p_echeance == AUCUNE_ECHEANCE
  * \post Un objet Processus valide est créé avec les valeurs assignées.
  */
-Processus::Processus(const std::string& p_pid, int p_arrivee, int p_duree, int p_priorite, TypeProcessus p_type)
+Processus::Processus(const std::string& p_pid, int p_arrivee, int p_duree, int p_priorite, TypeProcessus p_type,
+                     int p_echeance)
+    : Processus(TableIdentifiants::globale().interner(p_pid), p_arrivee, p_duree, p_priorite, p_type, p_echeance) {
+}
+
+/**
+ * \brief Constructeur de la classe Processus à partir d'un identifiant déjà interné.
+ * \param[in] p_pid Poignée de l'identifiant, obtenue de TableIdentifiants::interner().
+ * \param[in] p_arrivee Temps d'arrivée du processus dans le système.
+ * \param[in] p_duree Durée totale d'exécution du processus.
+ * \param[in] p_priorite Priorité du processus (un entier plus bas signifie une priorité plus haute).
+ * \param[in] p_type Type du processus (SYSTEME, INTERACTIF, BATCH, UTILISATEUR).
+ * \param[in] p_echeance Instant avant lequel le processus devrait avoir fini, ou AUCUNE_ECHEANCE.
+ * \pre p_pid < TableIdentifiants::globale().taille(), p_arrivee >= 0, p_duree > 0, p_priorite >= 0
+ * \pre p_echeance >= 0 ou p_echeance == AUCUNE_ECHEANCE
+ * \post Un objet Processus valide est créé avec les valeurs assignées.
+ */
+Processus::Processus(uint32_t p_pid, int p_arrivee, int p_duree, int p_priorite, TypeProcessus p_type,
+                     int p_echeance)
     : m_pid(p_pid), m_arrivee(p_arrivee), m_duree(p_duree), m_restant(p_duree), m_attente(0),
-      m_fin(0), m_priorite(p_priorite), m_type(p_type) {
-    PRECONDITION(p_pid != "")
+      m_fin(0), m_priorite(p_priorite), m_type(p_type), m_echeance(p_echeance),
+      m_rafales(TableRafales::SANS_RAFALES) {
+    PRECONDITION(p_pid < TableIdentifiants::globale().taille());
     PRECONDITION(p_arrivee >= 0);
     PRECONDITION(p_duree > 0);
     PRECONDITION(p_priorite >= 0);
+    PRECONDITION(p_echeance >= 0 || p_echeance == AUCUNE_ECHEANCE);
 
     POSTCONDITION(m_pid == p_pid);
     POSTCONDITION(m_arrivee == p_arrivee);
@@ -27,85 +54,15 @@ Processus::Processus(const std::string& p_pid, int p_arrivee, int p_duree, int p
 
 /**
  * \brief Retourne l'identifiant unique du processus.
+ *
+ *        Le texte est retrouvé dans la table des identifiants ; à réserver à
+ *        l'affichage, getPid() suffisant pour comparer.
+ *
  * \return Une chaîne de caractères contenant l'identifiant du processus.
  * \post L'identifiant retourné est non vide.
  */
 std::string Processus::getId() const {
-    ASSERTION(m_pid != "");
-    return m_pid;
-}
-
-/**
- * \brief Retourne le temps d'arrivée du processus.
- * \return Le temps d'arrivée (entier).
- * \post Le temps d'arrivée est supérieur ou égal à zéro.
- */
-int Processus::getArrivee() const {
-    ASSERTION(m_arrivee >= 0);
-    return m_arrivee;
-}
-
-/**
- * \brief Retourne la durée totale d'exécution du processus.
- * \return La durée (entier).
- * \post La durée retournée est positive.
- */
-int Processus::getDuree() const {
-    ASSERTION(m_duree >= 0);
-    return m_duree;
-}
-
-/**
- * \brief Retourne le temps restant d'exécution du processus.
- * \return Le temps restant (entier).
- * \post Le temps restant est supérieur ou égal à zéro.
- */
-int Processus::getRestant() const {
-    ASSERTION(m_restant >= 0);
-    return m_restant;
-}
-
-/**
- * \brief Retourne le temps d'attente du processus.
- * \return Le temps d'attente (entier).
- * \post Le temps d'attente est supérieur ou égal à zéro.
- */
-int Processus::getAttente() const {
-    ASSERTION(m_attente >= 0);
-    return m_attente;
-}
-
-/**
- * \brief Retourne le temps de fin du processus.
- * \return Le temps de fin (entier).
- * \post Le temps de fin est supérieur ou égal à zéro.
- */
-int Processus::getFin() const {
-    ASSERTION(m_fin >= 0);
-    return m_fin;
-}
-
-/**
- * \brief Retourne la priorité du processus.
- * \return La priorité (entier).
- * \post La priorité est un entier supérieur ou égal à zéro.
- */
-int Processus::getPriorite() const {
-    ASSERTION(m_priorite >= 0);
-    return m_priorite;
-}
-
-/**
- * \brief Retourne le type du processus.
- * \return Le type du processus (SYSTEME, INTERACTIF, BATCH, UTILISATEUR).
- * \post Le type est un type valide de TypeProcessus.
- */
-TypeProcessus Processus::getType() const {
-    ASSERTION(m_type == TypeProcessus::SYSTEME ||
-              m_type == TypeProcessus::INTERACTIF ||
-              m_type == TypeProcessus::BATCH ||
-              m_type == TypeProcessus::UTILISATEUR);
-    return m_type;
+    return TableIdentifiants::globale().nom(m_pid);
 }
 
 /**
@@ -203,6 +160,61 @@ void Processus::setType(TypeProcessus type) {
     POSTCONDITION(m_type == type);
 }
 
+/**
+ * \brief Met à jour l'échéance du processus.
+ * \param[in] echeance Instant avant lequel le processus devrait avoir fini, ou AUCUNE_ECHEANCE.
+ * \pre echeance >= 0 ou echeance == AUCUNE_ECHEANCE
+ * \post m_echeance est mis à jour avec la nouvelle valeur.
+ */
+void Processus::setEcheance(int echeance) {
+    PRECONDITION(echeance >= 0 || echeance == AUCUNE_ECHEANCE);
+    m_echeance = echeance;
+    POSTCONDITION(m_echeance == echeance);
+}
+
+/**
+ * \brief Retourne les rafales du processus : calcul, entrée-sortie, calcul, ...
+ * \return Les rafales, ou la seule rafale {durée} pour un processus de pur calcul.
+ */
+std::vector<int> Processus::getRafales() const {
+    return aEntreesSorties() ? TableRafales::globale().rafales(m_rafales) : std::vector<int>{m_duree};
+}
+
+/**
+ * \brief Indique si le processus fait des entrées-sorties entre ses rafales de calcul.
+ */
+bool Processus::aEntreesSorties() const {
+    return m_rafales != TableRafales::SANS_RAFALES;
+}
+
+/**
+ * \brief Retourne le temps total passé en entrée-sortie (somme des rafales d'entrée-sortie).
+ */
+int Processus::getEntreesSorties() const {
+    return aEntreesSorties() ? TableRafales::globale().entreesSorties(m_rafales) : 0;
+}
+
+/**
+ * \brief Remplace la durée du processus par une suite de rafales.
+ * \param[in] rafales Calcul, entrée-sortie, calcul, ..., commençant et finissant par du calcul.
+ * \pre Le processus n'a pas commencé (m_restant == m_duree).
+ * \pre rafales.size() est impair, chaque rafale > 0.
+ * \post m_duree et m_restant valent la somme des rafales de calcul.
+ *
+ * Les rafales sont internées dans TableRafales ; le processus n'en garde que la poignée.
+ */
+void Processus::setRafales(const std::vector<int>& rafales) {
+    PRECONDITION(m_restant == m_duree);
+    PRECONDITION(rafales.size() % 2 == 1);
+    PRECONDITION(std::all_of(rafales.begin(), rafales.end(), [](int r) { return r > 0; }));
+    int calcul = 0;
+    for (size_t k = 0; k < rafales.size(); k += 2) calcul += rafales[k];
+    m_rafales = rafales.size() > 1 ? TableRafales::globale().interner(rafales) : TableRafales::SANS_RAFALES;
+    m_duree = calcul;
+    m_restant = calcul;
+    POSTCONDITION(m_duree == calcul);
+}
+
 /**
  * \brief Surcharge de l'opérateur < pour comparer les priorités des processus.
  * \param[in] other Processus à comparer.
@@ -228,7 +240,7 @@ bool Processus::operator>(const Processus& other) const {
  * \brief Surcharge de l'opérateur == pour vérifier si deux processus sont identiques.
  * \param[in] other Processus à comparer.
  * \return true si les deux processus ont le même identifiant, sinon false.
- * \post Retourne true si les identifiants des processus sont identiques.
+ * \post Retourne true si les poignées d'identifiant des processus sont identiques.
  */
 bool Processus::operator==(const Processus& other) const {
     return m_pid == other.m_pid;
@@ -242,7 +254,7 @@ bool Processus::operator==(const Processus& other) const {
  * \post Les informations du processus sont correctement affichées dans le flux.
  */
 std::ostream& operator<<(std::ostream& os, const Processus& processus) {
-    os << processus.m_pid
+    os << processus.getId()
        << " arrivee : " << processus.m_arrivee
        << " Duree : " << processus.m_duree
        << " temps d'attente : " << processus.m_attente
@@ -263,6 +275,11 @@ std::ostream& operator<<(std::ostream& os, const Processus& processus) {
             os << 4;
         break;
     }
+    if (processus.aEcheance()) os << " Echeance : " << processus.m_echeance;
+    if (processus.aEntreesSorties()) {
+        os << " Rafales :";
+        for (int rafale : processus.getRafales()) os << " " << rafale;
+    }
 
     return os;
 }
@@ -277,11 +294,13 @@ std::ostream& operator<<(std::ostream& os, const Processus& processus) {
  * - Le temps d'attente est positif ou nul.
  * - Le temps restant est positif ou nul.
  * - Le type de processus est valide (SYSTEME, INTERACTIF, BATCH, UTILISATEUR).
+ * - L'échéance est positive ou nulle, ou absente.
+ * - La poignée des rafales est absente ou attribuée par TableRafales.
  *
  * \post Les conditions mentionnées ci-dessus doivent toujours être vérifiées pour maintenir l'intégrité de l'objet.
  */
 void Processus::verifieInvariant() const {
-    INVARIANT(m_pid != "")
+    INVARIANT(m_pid < TableIdentifiants::globale().taille());
     INVARIANT(m_priorite >= 0);
     INVARIANT(m_arrivee >= 0);
     INVARIANT(m_duree >= 0);
@@ -291,4 +310,6 @@ void Processus::verifieInvariant() const {
               m_type == TypeProcessus::INTERACTIF ||
               m_type == TypeProcessus::BATCH ||
               m_type == TypeProcessus::UTILISATEUR);
+    INVARIANT(m_echeance >= 0 || m_echeance == AUCUNE_ECHEANCE);
+    INVARIANT(m_rafales == TableRafales::SANS_RAFALES || m_rafales < TableRafales::globale().taille());
 }
\ No newline at end of file
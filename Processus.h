@@ -1,8 +1,11 @@
 #ifndef PROCESSUS_H
 #define PROCESSUS_H
 
+#include <cstdint>
 #include <string>
 #include <iostream>
+#include <vector>
+#include "ContratException.h"
 
 /**
  * \enum TypeProcessus
@@ -33,7 +36,7 @@ enum class TypeProcessus {
  *        et fournit des opérateurs pour comparer les priorités des processus.
  *        <p>
  *        Chaque processus est doté de caractéristiques suivantes :
- *        - Un ID unique sous forme de chaîne de caractères (m_pid)
+ *        - Un ID unique, interné dans TableIdentifiants ; seule sa poignée entière est stockée (m_pid)
  *        - Un temps d'arrivée dans le système (m_arrivee)
  *        - Une durée totale (m_duree)
  *        - Un temps restant pour l'exécution (m_restant)
@@ -41,18 +44,34 @@ enum class TypeProcessus {
  *        - Un temps de fin (m_fin)
  *        - Une priorité (m_priorite)
  *        - Un type de processus (m_type)
+ *        - Une échéance facultative (m_echeance) : l'instant avant lequel le processus
+ *          devrait avoir fini, ou AUCUNE_ECHEANCE
+ *        - Des rafales facultatives : calcul, entrée-sortie, calcul, ... pour un
+ *          processus qui alterne les deux. Comme l'identifiant, la suite est
+ *          internée, dans TableRafales, et seule sa poignée est stockée (m_rafales) ;
+ *          elle vaut TableRafales::SANS_RAFALES pour un processus de pur calcul,
+ *          qui n'a qu'une rafale de m_duree. m_duree est toujours la somme des
+ *          rafales de calcul.
  *
  * \invariant Le processus doit avoir une priorité positive ou nulle.
  * \invariant Le ID doit être non vide.
  * \invariant Le temps d'arrivée, la durée, et le temps restant doivent être positifs ou nuls.
  * \invariant Le temps d'attente doit être positif ou nul.
  * \invariant Le type de processus doit être valide (SYSTEME, INTERACTIF, BATCH, UTILISATEUR).
+ * \invariant L'échéance est positive ou nulle, ou vaut AUCUNE_ECHEANCE.
+ * \invariant La poignée des rafales est SANS_RAFALES ou a été attribuée par TableRafales.
  */
 class Processus {
 public:
-    Processus(const std::string& p_id, int p_arrivee, int p_duree, int p_priorite, TypeProcessus p_type);
+    static const int AUCUNE_ECHEANCE = -1;
+
+    Processus(const std::string& p_id, int p_arrivee, int p_duree, int p_priorite, TypeProcessus p_type,
+              int p_echeance = AUCUNE_ECHEANCE);
+    Processus(uint32_t p_pid, int p_arrivee, int p_duree, int p_priorite, TypeProcessus p_type,
+              int p_echeance = AUCUNE_ECHEANCE);
 
     std::string getId() const;
+    uint32_t getPid() const;
     int getArrivee() const;
     int getDuree() const;
     int getRestant() const;
@@ -60,6 +79,11 @@ public:
     int getFin() const;
     int getPriorite() const;
     TypeProcessus getType() const;
+    int getEcheance() const;
+    bool aEcheance() const;
+    std::vector<int> getRafales() const;
+    bool aEntreesSorties() const;
+    int getEntreesSorties() const;
 
 
     void setRestant(int restant);
@@ -70,6 +94,8 @@ public:
     void incArrivee(int arrivee);
     void incAttente(int attente);
     void setType(TypeProcessus type);
+    void setEcheance(int echeance);
+    void setRafales(const std::vector<int>& rafales);
 
 
     bool operator<(const Processus& other) const;
@@ -79,7 +105,7 @@ public:
     friend std::ostream& operator<<(std::ostream& os, const Processus& processus);
 
 private:
-    std::string m_pid;
+    uint32_t m_pid;
     int m_arrivee;
     int m_duree;
     int m_restant;
@@ -87,7 +113,105 @@ private:
     int m_fin;
     int m_priorite;
     TypeProcessus m_type;
+    int m_echeance;
+    uint32_t m_rafales;
     void verifieInvariant () const;
 };
 
+// Les accesseurs sont définis ici pour être développés en ligne dans les boucles
+// de sélection des ordonnanceurs.
+
+/**
+ * \brief Retourne la poignée entière de l'identifiant du processus.
+ * \return La poignée attribuée par TableIdentifiants.
+ */
+inline uint32_t Processus::getPid() const {
+    return m_pid;
+}
+
+/**
+ * \brief Retourne le temps d'arrivée du processus.
+ * \return Le temps d'arrivée (entier).
+ * \post Le temps d'arrivée est supérieur ou égal à zéro.
+ */
+inline int Processus::getArrivee() const {
+    ASSERTION(m_arrivee >= 0);
+    return m_arrivee;
+}
+
+/**
+ * \brief Retourne la durée totale d'exécution du processus.
+ * \return La durée (entier).
+ * \post La durée retournée est positive.
+ */
+inline int Processus::getDuree() const {
+    ASSERTION(m_duree >= 0);
+    return m_duree;
+}
+
+/**
+ * \brief Retourne le temps restant d'exécution du processus.
+ * \return Le temps restant (entier).
+ * \post Le temps restant est supérieur ou égal à zéro.
+ */
+inline int Processus::getRestant() const {
+    ASSERTION(m_restant >= 0);
+    return m_restant;
+}
+
+/**
+ * \brief Retourne le temps d'attente du processus.
+ * \return Le temps d'attente (entier).
+ * \post Le temps d'attente est supérieur ou égal à zéro.
+ */
+inline int Processus::getAttente() const {
+    ASSERTION(m_attente >= 0);
+    return m_attente;
+}
+
+/**
+ * \brief Retourne le temps de fin du processus.
+ * \return Le temps de fin (entier).
+ * \post Le temps de fin est supérieur ou égal à zéro.
+ */
+inline int Processus::getFin() const {
+    ASSERTION(m_fin >= 0);
+    return m_fin;
+}
+
+/**
+ * \brief Retourne la priorité du processus.
+ * \return La priorité (entier).
+ * \post La priorité est un entier supérieur ou égal à zéro.
+ */
+inline int Processus::getPriorite() const {
+    ASSERTION(m_priorite >= 0);
+    return m_priorite;
+}
+
+/**
+ * \brief Retourne le type du processus.
+ * \return Le type du processus (SYSTEME, INTERACTIF, BATCH, UTILISATEUR).
+ * \post Le type est un type valide de TypeProcessus.
+ */
+inline TypeProcessus Processus::getType() const {
+    ASSERTION(static_cast<unsigned int>(m_type) - 1u < 4u);
+    return m_type;
+}
+
+/**
+ * \brief Retourne l'échéance du processus.
+ * \return L'instant avant lequel le processus devrait avoir fini, ou AUCUNE_ECHEANCE.
+ */
+inline int Processus::getEcheance() const {
+    return m_echeance;
+}
+
+/**
+ * \brief Indique si le processus a une échéance.
+ */
+inline bool Processus::aEcheance() const {
+    return m_echeance != AUCUNE_ECHEANCE;
+}
+
 #endif // PROCESSUS_H
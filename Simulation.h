@@ -0,0 +1,381 @@
+//
+// Created by Vincent on 10/1/2024.
+//
+
+#ifndef SIMULATION_H
+#define SIMULATION_H
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+#include "ContratException.h"
+#include "TableProcessus.h"
+#include "TasIndexe.h"
+
+/**
+ * \brief Valeur de tranche d'une politique qui laisse le processus s'exécuter jusqu'au bout.
+ */
+const int TRANCHE_ILLIMITEE = std::numeric_limits<int>::max();
+
+/**
+ * \brief Coût d'une commutation de contexte : le processeur perd ce temps sans
+ *        faire progresser le processus qu'il vient d'élire.
+ *
+ *        Une commutation coûte base, plus une pénalité de rechargement du cache
+ *        qui croît linéairement avec le temps écoulé depuis la dernière exécution
+ *        du processus, de 0 à rechauffement une fois refroidissement écoulé. Un
+ *        processus qui n'a jamais tourné paie la pénalité entière. CoutCommutation()
+ *        (tout à zéro) rend les commutations gratuites.
+ */
+struct CoutCommutation {
+  int base;
+  int rechauffement;
+  int refroidissement;
+
+  int duree(int absence) const;
+};
+
+/**
+ * \brief Temps perdu par une commutation vers un processus absent du processeur depuis absence.
+ * \param[in] absence Temps écoulé depuis la dernière exécution, ou une valeur négative s'il n'a jamais tourné.
+ */
+inline int CoutCommutation::duree(int absence) const {
+  if (absence < 0 || absence >= refroidissement) return base + rechauffement;
+  return base + static_cast<int>(static_cast<long long>(rechauffement) * absence / refroidissement);
+}
+
+/**
+ * \brief Activité du processeur pendant une simulation : commutations, temps utile
+ *        et recouvrement des entrées-sorties.
+ *
+ *        Une commutation a lieu quand le processeur élit un autre processus que
+ *        le dernier qu'il a exécuté ; réélire le même après sa tranche est gratuit.
+ *        surcout ne compte que le temps réellement perdu : une préemption pendant
+ *        une commutation en interrompt le coût.
+ *
+ *        occupation est le temps où le processeur a fait progresser un processus.
+ *        entreesSorties est le temps pendant lequel un processus au moins attendait
+ *        la fin d'une entrée-sortie, et chevauchement la part de ce temps où le
+ *        processeur faisait progresser un autre processus.
+ */
+struct BilanProcesseur {
+  long long commutations;
+  long long surcout;
+  long long duree;            ///< De l'instant de départ au dernier événement simulé.
+  long long occupation;
+  long long entreesSorties;
+  long long chevauchement;
+
+  double utilisation() const;
+  double recouvrement() const;
+  std::string toString() const;
+};
+
+/**
+ * \brief Part de la durée pendant laquelle le processeur a fait un travail utile.
+ */
+inline double BilanProcesseur::utilisation() const {
+  return duree == 0 ? 0 : static_cast<double>(occupation) / static_cast<double>(duree);
+}
+
+/**
+ * \brief Part du temps d'entrées-sorties recouverte par du calcul, 0 sans entrées-sorties.
+ */
+inline double BilanProcesseur::recouvrement() const {
+  return entreesSorties == 0 ? 0 : static_cast<double>(chevauchement) / static_cast<double>(entreesSorties);
+}
+
+/**
+ * \brief Une ligne : commutations, surcoût total, utilisation et, s'il y en a eu,
+ *        recouvrement des entrées-sorties (en pourcentages entiers).
+ */
+inline std::string BilanProcesseur::toString() const {
+  std::string ligne = "Commutations : " + std::to_string(commutations) + ", surcout : " + std::to_string(surcout) +
+                      ", utilisation : " + std::to_string(static_cast<int>(utilisation() * 100 + 0.5)) + " %";
+  if (entreesSorties > 0) {
+    ligne += ", recouvrement E/S : " + std::to_string(static_cast<int>(recouvrement() * 100 + 0.5)) + " %";
+  }
+  return ligne;
+}
+
+/**
+ * \brief Fin d'une entrée-sortie : le processus index redevient prêt à instant.
+ */
+struct Reveil {
+  int instant;
+  uint32_t index;
+};
+
+/**
+ * \brief Ordre des réveils : le plus proche d'abord.
+ */
+struct ParInstant {
+  bool operator()(const Reveil& a, const Reveil& b) const {
+    return a.instant < b.instant;
+  }
+};
+
+/**
+ * \brief Moteur de simulation à événements discrets commun aux ordonnanceurs.
+ *
+ *        Les arrivées sont triées une fois (tri stable : à arrivée égale, l'ordre
+ *        de la table départage) et consommées par un curseur ; c'est la file des
+ *        événements d'arrivée. L'horloge saute directement à l'événement suivant :
+ *        prochaine arrivée, prochain réveil ou fin de la tranche en cours. Quand
+ *        aucun processus n'est prêt, elle saute à la prochaine arrivée ou au
+ *        prochain réveil, et le processeur reste inactif entre-temps.
+ *
+ *        Un processus qui a des rafales (voir TableProcessus::definirRafales())
+ *        se bloque à la fin de chacune de ses rafales de calcul, sauf la
+ *        dernière : il quitte le processeur et son réveil est programmé après
+ *        l'entrée-sortie qui suit, dans un tas indexé par instant. Chaque
+ *        processus a son propre périphérique : les entrées-sorties de plusieurs
+ *        processus se déroulent en même temps. Au réveil, le processus redevient
+ *        prêt comme à une arrivée ; les arrivées d'un instant passent avant ses
+ *        réveils, puis les réveils dans l'ordre où ils ont été programmés.
+ *
+ *        Le choix du processus est délégué à la politique, qui gère sa propre
+ *        file des prêts et doit offrir :
+ *        - void ajouter(uint32_t i, int horloge) : i devient prêt (arrivée,
+ *          réveil ou retour après une tranche) ;
+ *        - void bloquer(uint32_t i, int horloge) : l'élu i quitte le processeur
+ *          pour une entrée-sortie ; il reviendra par ajouter() ;
+ *        - bool estVide() const ;
+ *        - uint32_t extraire(int horloge) : retire et retourne le prochain élu ;
+ *        - int tranche(uint32_t i, int horloge) const : durée maximale
+ *          d'exécution, à partir de l'instant horloge, avant de rendre la main, ou TRANCHE_ILLIMITEE ;
+ *          consultée à l'élection puis après chaque arrivée, la tranche ne
+ *          pouvant que raccourcir ;
+ *        - bool preempte(uint32_t courant, int horloge) const : vrai si un
+ *          processus prêt doit remplacer courant, consulté après chaque arrivée
+ *          ou réveil.
+ *
+ *        À la fin d'une tranche, les arrivées et réveils du même instant entrent
+ *        dans la file des prêts avant le processus interrompu.
+ *
+ *        Chaque événement coûte O(1) plus le coût de la politique : O(n log n) au
+ *        total avec un tas, O(n + nombre de tranches) avec une file FIFO. Un
+ *        réveil coûte en plus O(log du nombre d'entrées-sorties en cours) ; une
+ *        table sans rafales n'alloue rien pour elles.
+ *
+ *        Chaque commutation (voir CoutCommutation) occupe le processeur pendant
+ *        commutation.duree() unités avant que l'élu ne progresse, et ce temps
+ *        entre dans son attente. tranche() est toujours demandée à l'instant où
+ *        l'élu progresse, fin de commutation comprise, et comptée à partir de
+ *        lui : une tranche fixée par un instant (vieillissement) finit à cet
+ *        instant, et une politique qui compte la tranche depuis l'élection
+ *        (CFS, MLFQ) impute la commutation à l'élu. L'élu progresse toujours
+ *        d'au moins une unité, même si la commutation couvre toute sa tranche.
+ *        Avec des coûts nuls, le
+ *        résultat est celui d'un processeur qui commute gratuitement.
+ *
+ *        Après chaque fin de processus, arret(i, horloge) est consulté ; s'il
+ *        retourne vrai, la simulation s'arrête là et seuls les processus déjà
+ *        terminés ont leurs colonnes attente et fin à jour. Sert à abandonner une
+ *        simulation dont le résultat n'intéresse plus (voir Balayage.h).
+ *
+ * \param[in,out] table Les processus ; les colonnes restant, attente et fin sont mises à jour.
+ * \param[in,out] politique La politique d'ordonnancement, initialement vide.
+ * \param[in] temps L'instant de départ de l'horloge.
+ * \param[in,out] arret Appelable bool(uint32_t i, int horloge), consulté à chaque fin.
+ * \param[in] commutation Coût d'une commutation.
+ * \param[out] bilan Si non nul, reçoit les commutations, l'occupation du processeur et le
+ *             recouvrement des entrées-sorties.
+ * \return Les indices des processus dans l'ordre où ils se terminent.
+ * \pre temps >= 0, coûts de commutation positifs ou nuls
+ * \pre Les processus qui ont des rafales n'ont pas commencé.
+ * \post Chaque processus terminé a fin == arrivée + durée + entrées-sorties + attente, avec attente >= 0.
+ */
+template <typename Politique, typename Arret>
+std::vector<uint32_t> simuler(TableProcessus& table, Politique& politique, int temps, Arret& arret,
+                              const CoutCommutation& commutation, BilanProcesseur* bilan = nullptr) {
+  PRECONDITION(temps >= 0);
+  PRECONDITION(politique.estVide());
+  PRECONDITION(commutation.base >= 0 && commutation.rechauffement >= 0 && commutation.refroidissement >= 0);
+
+  const uint32_t AUCUN = std::numeric_limits<uint32_t>::max();
+  const std::vector<int>& arrivee = table.arrivees();
+  const size_t n = table.taille();
+
+  std::vector<uint32_t> arrivees(n);
+  std::iota(arrivees.begin(), arrivees.end(), 0u);
+  std::stable_sort(arrivees.begin(), arrivees.end(),
+                   [&arrivee](uint32_t a, uint32_t b) { return arrivee[a] < arrivee[b]; });
+
+  std::vector<uint32_t> ordre;
+  ordre.reserve(n);
+  size_t curseur = 0;
+  int horloge = temps;
+  uint32_t courant = AUCUN;
+  int finTranche = 0;
+
+  const bool gratuit = commutation.base == 0 && commutation.rechauffement == 0;
+  uint32_t precedent = AUCUN;   // Dernier processus exécuté : il n'y a pas de commutation à le réélire.
+  int reprise = horloge;        // Fin de la commutation en cours : courant progresse à partir de là.
+  std::vector<int> derniereExecution(commutation.rechauffement > 0 ? n : 0, -1);
+  BilanProcesseur mesures{0, 0, 0, 0, 0, 0};
+
+  const bool entreesSorties = table.aDesEntreesSorties();
+  std::vector<uint32_t> rafale(entreesSorties ? n : 0, 0);   // Rang de la rafale de calcul en cours.
+  std::vector<int> seuil(entreesSorties ? n : 0, 0);         // Temps restant à la fin de cette rafale.
+  TasIndexe<Reveil, ParInstant> reveils;
+  for (uint32_t i = 0; i < seuil.size(); ++i) {
+    PRECONDITION(table.nombreRafales(i) == 1 || table.restants()[i] == table.durees()[i]);
+    seuil[i] = table.restants()[i] - std::min(table.restants()[i], table.rafale(i, 0));
+  }
+
+  auto admettre = [&]() {
+    while (curseur < n && arrivee[arrivees[curseur]] <= horloge) {
+      politique.ajouter(arrivees[curseur], horloge);
+      ++curseur;
+    }
+    while (!reveils.estVide() && reveils.sommet().instant <= horloge) {
+      politique.ajouter(reveils.extraireSommet().index, horloge);
+    }
+  };
+
+  auto prochainEvenement = [&]() {
+    int instant = curseur < n ? arrivee[arrivees[curseur]] : std::numeric_limits<int>::max();
+    return reveils.estVide() ? instant : std::min(instant, reveils.sommet().instant);
+  };
+
+  auto resteRafale = [&](uint32_t i) {
+    return table.restants()[i] - (entreesSorties ? seuil[i] : 0);
+  };
+
+  auto quitter = [&]() {
+    if (!derniereExecution.empty()) derniereExecution[courant] = horloge;
+    courant = AUCUN;
+  };
+
+  while (ordre.size() < n) {
+    admettre();
+
+    if (courant != AUCUN && politique.preempte(courant, horloge)) {
+      politique.ajouter(courant, horloge);
+      quitter();
+    }
+
+    if (courant == AUCUN) {
+      if (politique.estVide()) {
+        int instant = prochainEvenement();
+        if (!reveils.estVide()) mesures.entreesSorties += instant - horloge;
+        horloge = instant;
+        continue;
+      }
+      courant = politique.extraire(horloge);
+      reprise = horloge;
+      if (!gratuit && courant != precedent) {
+        int absence = derniereExecution.empty() || derniereExecution[courant] < 0
+                          ? -1 : horloge - derniereExecution[courant];
+        reprise += commutation.duree(absence);
+        ++mesures.commutations;
+      }
+      precedent = courant;
+      // Au moins une unité : une commutation qui couvre toute la part de l'élu
+      // ne doit pas le renvoyer sans qu'il progresse, ce qui tournerait sans fin.
+      finTranche = reprise + std::min(resteRafale(courant), std::max(1, politique.tranche(courant, reprise)));
+    } else {
+      int debut = std::max(horloge, reprise);
+      finTranche = std::min(finTranche, debut + std::min(resteRafale(courant), politique.tranche(courant, debut)));
+    }
+
+    int instant = std::min(finTranche, prochainEvenement());
+
+    RefProcessus pris = table[courant];
+    if (horloge < reprise) mesures.surcout += std::min(instant, reprise) - horloge;
+    int execute = std::max(0, instant - std::max(horloge, reprise));
+    pris.setRestant(pris.getRestant() - execute);
+    mesures.occupation += execute;
+    if (!reveils.estVide()) {
+      mesures.entreesSorties += instant - horloge;
+      mesures.chevauchement += execute;
+    }
+    horloge = instant;
+
+    if (pris.getRestant() == 0) {
+      pris.setFin(horloge);
+      pris.setAttente(horloge - pris.getArrivee() - pris.getDuree() -
+                      (entreesSorties ? table.entreesSorties(courant) : 0));
+      ordre.push_back(courant);
+      if (arret(courant, horloge)) break;
+      quitter();
+    } else if (entreesSorties && pris.getRestant() == seuil[courant]) {
+      politique.bloquer(courant, horloge);
+      uint32_t k = rafale[courant];
+      reveils.inserer(Reveil{horloge + table.rafale(courant, k + 1), courant});
+      rafale[courant] = k + 2;
+      seuil[courant] -= table.rafale(courant, k + 2);
+      quitter();
+    } else if (horloge == finTranche) {
+      admettre();
+      politique.ajouter(courant, horloge);
+      quitter();
+    }
+  }
+
+  mesures.duree = horloge - temps;
+  if (bilan != nullptr) *bilan = mesures;
+  POSTCONDITION(curseur == n || ordre.size() < n);
+  return ordre;
+}
+
+/**
+ * \brief Simule avec des commutations gratuites (voir la version avec coût de commutation).
+ * \param[in,out] table Les processus ; les colonnes restant, attente et fin sont mises à jour.
+ * \param[in,out] politique La politique d'ordonnancement, initialement vide.
+ * \param[in] temps L'instant de départ de l'horloge.
+ * \param[in,out] arret Appelable bool(uint32_t i, int horloge), consulté à chaque fin.
+ * \return Les indices des processus dans l'ordre où ils se terminent.
+ * \pre temps >= 0
+ */
+template <typename Politique, typename Arret>
+std::vector<uint32_t> simuler(TableProcessus& table, Politique& politique, int temps, Arret& arret) {
+  return simuler(table, politique, temps, arret, CoutCommutation());
+}
+
+/**
+ * \brief Critère d'arrêt de simuler() qui laisse la simulation aller jusqu'au bout.
+ */
+struct SansArret {
+  bool operator()(uint32_t, int) const {
+    return false;
+  }
+};
+
+/**
+ * \brief Simule jusqu'à la fin de tous les processus (voir la version avec critère d'arrêt).
+ * \param[in,out] table Les processus ; les colonnes restant, attente et fin sont mises à jour.
+ * \param[in,out] politique La politique d'ordonnancement, initialement vide.
+ * \param[in] temps L'instant de départ de l'horloge.
+ * \return Les indices des processus dans l'ordre où ils se terminent.
+ * \pre temps >= 0
+ * \post Chaque processus a fin == arrivée + durée + entrées-sorties + attente, avec attente >= 0.
+ */
+template <typename Politique>
+std::vector<uint32_t> simuler(TableProcessus& table, Politique& politique, int temps) {
+  SansArret jamais;
+  return simuler(table, politique, temps, jamais);
+}
+
+/**
+ * \brief Simule jusqu'à la fin de tous les processus, en mesurant l'activité du processeur.
+ * \param[in,out] table Les processus ; les colonnes restant, attente et fin sont mises à jour.
+ * \param[in,out] politique La politique d'ordonnancement, initialement vide.
+ * \param[in] temps L'instant de départ de l'horloge.
+ * \param[in] commutation Coût d'une commutation.
+ * \param[out] bilan Si non nul, reçoit les commutations, l'occupation du processeur et le
+ *             recouvrement des entrées-sorties.
+ * \return Les indices des processus dans l'ordre où ils se terminent.
+ * \pre temps >= 0
+ */
+template <typename Politique>
+std::vector<uint32_t> simuler(TableProcessus& table, Politique& politique, int temps,
+                              const CoutCommutation& commutation, BilanProcesseur* bilan) {
+  SansArret jamais;
+  return simuler(table, politique, temps, jamais, commutation, bilan);
+}
+
+#endif //SIMULATION_H
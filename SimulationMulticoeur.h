@@ -0,0 +1,283 @@
+//
+// Created by Vincent on 10/1/2024.
+//
+
+#ifndef SIMULATIONMULTICOEUR_H
+#define SIMULATIONMULTICOEUR_H
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+#include "ContratException.h"
+#include "Simulation.h"
+#include "TableProcessus.h"
+
+/**
+ * \enum Equilibrage
+ * \brief Répartition des processus prêts entre les cœurs.
+ *
+ *        - FILE_GLOBALE : une seule file des prêts, servie par tous les cœurs.
+ *        - FILES_PAR_COEUR : une file par cœur ; une arrivée va au cœur le moins
+ *          chargé et n'en bouge plus.
+ *        - VOL_DE_TRAVAIL : une file par cœur ; un cœur dont la file est vide
+ *          prend le prochain élu de la file la plus chargée.
+ */
+enum class Equilibrage {
+  FILE_GLOBALE,
+  FILES_PAR_COEUR,
+  VOL_DE_TRAVAIL
+};
+
+/**
+ * \brief Paramètres d'une simulation multicœur.
+ */
+struct ConfigMulticoeur {
+  int coeurs;
+  Equilibrage equilibrage;
+  int coutMigration;   ///< Temps perdu quand un processus reprend sur un autre cœur que le précédent.
+};
+
+/**
+ * \brief Résultats d'une simulation multicœur, en plus des colonnes de la table.
+ */
+struct StatistiquesMulticoeur {
+  std::vector<uint32_t> ordre;         ///< Indices des processus dans leur ordre de fin.
+  std::vector<long long> occupation;   ///< Temps d'exécution utile de chaque cœur.
+  std::vector<long long> surcout;      ///< Temps de migration payé par chaque cœur.
+  long long duree;                     ///< De l'instant de départ à la dernière fin.
+  long long migrations;
+  long long vols;
+
+  double utilisation(size_t coeur) const;
+  double utilisationMoyenne() const;
+  double desequilibre() const;
+};
+
+/**
+ * \brief Part du temps pendant laquelle un cœur a exécuté du travail utile.
+ * \param[in] coeur Numéro du cœur.
+ * \pre coeur < occupation.size()
+ */
+inline double StatistiquesMulticoeur::utilisation(size_t coeur) const {
+  PRECONDITION(coeur < occupation.size());
+  return duree == 0 ? 0 : static_cast<double>(occupation[coeur]) / static_cast<double>(duree);
+}
+
+/**
+ * \brief Utilisation moyenne des cœurs.
+ */
+inline double StatistiquesMulticoeur::utilisationMoyenne() const {
+  if (occupation.empty() || duree == 0) return 0;
+  long long total = std::accumulate(occupation.begin(), occupation.end(), 0LL);
+  return static_cast<double>(total) / static_cast<double>(duree) / static_cast<double>(occupation.size());
+}
+
+/**
+ * \brief Déséquilibre de charge : (occupation maximale − moyenne) / moyenne.
+ * \return 0 pour une charge parfaitement répartie, ou si aucun cœur n'a travaillé.
+ */
+inline double StatistiquesMulticoeur::desequilibre() const {
+  if (occupation.empty()) return 0;
+  long long total = std::accumulate(occupation.begin(), occupation.end(), 0LL);
+  if (total == 0) return 0;
+  double moyenne = static_cast<double>(total) / static_cast<double>(occupation.size());
+  return (static_cast<double>(*std::max_element(occupation.begin(), occupation.end())) - moyenne) / moyenne;
+}
+
+/**
+ * \brief Moteur de simulation à événements discrets sur plusieurs cœurs.
+ *
+ *        Même modèle que simuler() (Simulation.h), avec la même interface de
+ *        politique, mais plusieurs processus s'exécutent en même temps. Selon
+ *        config.equilibrage, la politique est copiée une fois (file globale) ou
+ *        une fois par cœur ; les copies partent du prototype, vide, et ne
+ *        partagent que l'état par processus que la politique choisit de
+ *        partager (voir PolitiqueMlfq).
+ *
+ *        Un processus volé est extrait de la file de la victime, mais sa
+ *        tranche, preempte() et son retour sont demandés à la copie du voleur.
+ *        Tout état par processus que ces fonctions lisent, comme le début de
+ *        la tranche de l'élu, doit donc être partagé entre les copies, comme
+ *        le font PolitiqueMlfq, PolitiqueStride et PolitiqueCfs.
+ *
+ *        À chaque instant d'événement, dans l'ordre : les cœurs avancent, les
+ *        arrivées entrent dans leur file, les processus en fin de tranche
+ *        retournent dans la file de leur cœur, les cœurs libres élisent (en
+ *        volant au besoin), puis chaque cœur occupé est soumis à preempte() et
+ *        sa tranche est recalculée. Avec un seul cœur, le résultat est celui de
+ *        simuler().
+ *
+ *        Un processus élu sur un autre cœur que celui où il s'est exécuté en
+ *        dernier compte une migration ; le cœur passe alors coutMigration unités
+ *        sans le faire progresser, puis la tranche commence. Ce surcoût entre
+ *        dans le temps d'attente du processus ; comme dans simuler(), tranche()
+ *        est demandée à l'instant où le processus progresse, et l'élu progresse
+ *        d'au moins une unité.
+ *
+ *        Chaque événement coûte O(nombre de cœurs) plus le coût de la politique.
+ *        Les entrées-sorties (rafales) ne sont simulées que par simuler().
+ *
+ * \param[in,out] table Les processus ; les colonnes restant, attente et fin sont mises à jour.
+ * \param[in] prototype La politique d'ordonnancement, vide.
+ * \param[in] config Nombre de cœurs, équilibrage et coût de migration.
+ * \param[in] temps L'instant de départ de l'horloge.
+ * \return L'ordre de fin et les mesures par cœur.
+ * \pre temps >= 0, config.coeurs > 0, config.coutMigration >= 0
+ * \pre Aucun processus ne fait d'entrées-sorties (voir simuler()).
+ * \post Chaque processus a fin == arrivée + durée + attente, avec attente >= 0.
+ */
+template <typename Politique>
+StatistiquesMulticoeur simulerMulticoeur(TableProcessus& table, const Politique& prototype,
+                                         const ConfigMulticoeur& config, int temps) {
+  PRECONDITION(temps >= 0);
+  PRECONDITION(config.coeurs > 0);
+  PRECONDITION(config.coutMigration >= 0);
+  PRECONDITION(prototype.estVide());
+  PRECONDITION(!table.aDesEntreesSorties());
+
+  struct Coeur {
+    uint32_t courant;
+    int reprise;      // Fin du surcoût de migration : le processus progresse à partir de là.
+    int compte;       // Instant jusqu'où l'exécution a été comptée.
+    int finTranche;
+  };
+
+  const uint32_t AUCUN = std::numeric_limits<uint32_t>::max();
+  const bool globale = config.equilibrage == Equilibrage::FILE_GLOBALE;
+  const size_t nc = static_cast<size_t>(config.coeurs);
+  const std::vector<int>& arrivee = table.arrivees();
+  const size_t n = table.taille();
+
+  std::vector<uint32_t> arrivees(n);
+  std::iota(arrivees.begin(), arrivees.end(), 0u);
+  std::stable_sort(arrivees.begin(), arrivees.end(),
+                   [&arrivee](uint32_t a, uint32_t b) { return arrivee[a] < arrivee[b]; });
+
+  std::vector<Politique> files(globale ? 1 : nc, prototype);
+  std::vector<size_t> prets(files.size(), 0);
+  std::vector<Coeur> coeurs(nc, Coeur{AUCUN, 0, 0, 0});
+  std::vector<uint32_t> dernierCoeur(n, AUCUN);
+  std::vector<size_t> retours;
+
+  StatistiquesMulticoeur stats;
+  stats.ordre.reserve(n);
+  stats.occupation.assign(nc, 0);
+  stats.surcout.assign(nc, 0);
+  stats.migrations = 0;
+  stats.vols = 0;
+
+  size_t curseur = 0;
+  int horloge = temps;
+
+  auto fileDe = [globale](size_t k) { return globale ? 0 : k; };
+
+  auto avancer = [&](size_t k) {
+    Coeur& c = coeurs[k];
+    if (c.compte < c.reprise) stats.surcout[k] += std::min(horloge, c.reprise) - c.compte;
+    int debut = std::max(c.compte, c.reprise);
+    if (horloge > debut) {
+      RefProcessus pris = table[c.courant];
+      pris.setRestant(pris.getRestant() - (horloge - debut));
+      stats.occupation[k] += horloge - debut;
+    }
+    c.compte = horloge;
+  };
+
+  auto elire = [&](size_t k) {
+    size_t f = fileDe(k);
+    if (prets[f] == 0 && config.equilibrage == Equilibrage::VOL_DE_TRAVAIL) {
+      f = static_cast<size_t>(std::max_element(prets.begin(), prets.end()) - prets.begin());
+      if (prets[f] == 0) return;
+      ++stats.vols;
+    }
+    if (prets[f] == 0) return;
+
+    uint32_t i = files[f].extraire(horloge);
+    --prets[f];
+    int surcout = 0;
+    if (dernierCoeur[i] != AUCUN && dernierCoeur[i] != k) {
+      ++stats.migrations;
+      surcout = config.coutMigration;
+    }
+    dernierCoeur[i] = static_cast<uint32_t>(k);
+
+    Coeur& c = coeurs[k];
+    c.courant = i;
+    c.compte = horloge;
+    c.reprise = horloge + surcout;
+    c.finTranche = c.reprise + std::min(table[i].getRestant(), std::max(1, files[fileDe(k)].tranche(i, c.reprise)));
+  };
+
+  auto rendre = [&](size_t k) {
+    files[fileDe(k)].ajouter(coeurs[k].courant, horloge);
+    ++prets[fileDe(k)];
+    coeurs[k].courant = AUCUN;
+  };
+
+  while (stats.ordre.size() < n) {
+    for (size_t k = 0; k < nc; ++k) {
+      if (coeurs[k].courant == AUCUN) continue;
+      avancer(k);
+      RefProcessus pris = table[coeurs[k].courant];
+      if (pris.getRestant() == 0) {
+        pris.setFin(horloge);
+        pris.setAttente(horloge - pris.getArrivee() - pris.getDuree());
+        stats.ordre.push_back(coeurs[k].courant);
+        coeurs[k].courant = AUCUN;
+      } else if (horloge >= coeurs[k].finTranche) {
+        retours.push_back(k);
+      }
+    }
+
+    while (curseur < n && arrivee[arrivees[curseur]] <= horloge) {
+      size_t f = 0;
+      if (!globale) {
+        size_t charge = std::numeric_limits<size_t>::max();
+        for (size_t k = 0; k < nc; ++k) {
+          size_t chargeK = prets[k] + (coeurs[k].courant != AUCUN ? 1 : 0);
+          if (chargeK < charge) {
+            charge = chargeK;
+            f = k;
+          }
+        }
+      }
+      files[f].ajouter(arrivees[curseur], horloge);
+      ++prets[f];
+      ++curseur;
+    }
+
+    for (size_t k : retours) rendre(k);
+    retours.clear();
+
+    for (size_t k = 0; k < nc; ++k) {
+      if (coeurs[k].courant == AUCUN) elire(k);
+    }
+
+    for (size_t k = 0; k < nc; ++k) {
+      Coeur& c = coeurs[k];
+      if (c.courant == AUCUN) continue;
+      Politique& file = files[fileDe(k)];
+      if (prets[fileDe(k)] > 0 && file.preempte(c.courant, horloge)) {
+        rendre(k);
+        elire(k);
+      } else {
+        int debut = std::max(horloge, c.reprise);
+        c.finTranche = std::min(c.finTranche,
+                                debut + std::min(table[c.courant].getRestant(), file.tranche(c.courant, debut)));
+      }
+    }
+
+    int prochain = curseur < n ? arrivee[arrivees[curseur]] : std::numeric_limits<int>::max();
+    for (const Coeur& c : coeurs) {
+      if (c.courant != AUCUN) prochain = std::min(prochain, c.finTranche);
+    }
+    if (stats.ordre.size() < n) horloge = prochain;
+  }
+
+  stats.duree = horloge - temps;
+  POSTCONDITION(curseur == n);
+  return stats;
+}
+
+#endif //SIMULATIONMULTICOEUR_H
@@ -0,0 +1,74 @@
+#include "TableIdentifiants.h"
+#include "ContratException.h"
+
+/**
+ * \brief Constructeur d'une table vide.
+ */
+TableIdentifiants::TableIdentifiants() : m_taille(0) {
+}
+
+/**
+ * \brief Table partagée par tout le programme.
+ * \return L'unique instance, créée au premier appel.
+ */
+TableIdentifiants& TableIdentifiants::globale() {
+    static TableIdentifiants table;
+    return table;
+}
+
+/**
+ * \brief Donne la poignée d'un identifiant, en l'ajoutant s'il est nouveau.
+ * \param[in] p_id L'identifiant textuel du processus.
+ * \return La poignée entière de l'identifiant ; deux appels avec le même texte donnent la même poignée.
+ * \pre p_id != ""
+ * \post nom(poignée) == p_id
+ */
+uint32_t TableIdentifiants::interner(const std::string& p_id) {
+    PRECONDITION(p_id != "");
+    std::lock_guard<std::mutex> verrou(m_verrou);
+
+    auto trouve = m_index.find(p_id);
+    if (trouve != m_index.end()) {
+        return trouve->second;
+    }
+
+    uint32_t pid = static_cast<uint32_t>(m_noms.size());
+    m_noms.push_back(p_id);
+    m_index.emplace(p_id, pid);
+    m_taille.store(m_noms.size(), std::memory_order_release);
+
+    POSTCONDITION(m_noms[pid] == p_id);
+    INVARIANTS();
+    return pid;
+}
+
+/**
+ * \brief Retrouve l'identifiant textuel d'une poignée.
+ * \param[in] pid La poignée.
+ * \return L'identifiant textuel.
+ * \pre pid < taille()
+ */
+std::string TableIdentifiants::nom(uint32_t pid) const {
+    PRECONDITION(pid < taille());
+    std::lock_guard<std::mutex> verrou(m_verrou);
+    return m_noms[pid];
+}
+
+/**
+ * \brief Nombre d'identifiants internés.
+ */
+size_t TableIdentifiants::taille() const {
+    return m_taille.load(std::memory_order_acquire);
+}
+
+/**
+ * \brief Vérifie l'invariant de la classe TableIdentifiants.
+ *
+ * L'invariant de cette classe s'assure que :
+ * - Chaque identifiant a exactement une poignée.
+ * - Le compteur lisible sans verrou suit le nombre d'identifiants.
+ */
+void TableIdentifiants::verifieInvariant() const {
+    INVARIANT(m_index.size() == m_noms.size());
+    INVARIANT(m_taille.load(std::memory_order_relaxed) == m_noms.size());
+}
@@ -0,0 +1,47 @@
+#ifndef TABLEIDENTIFIANTS_H
+#define TABLEIDENTIFIANTS_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \class TableIdentifiants
+ * \brief Table d'internement des identifiants de processus ("p1", "p2", ...).
+ *
+ *        Chaque identifiant textuel reçoit, au chargement, une poignée entière
+ *        dense (0, 1, 2, ...). Les processus ne transportent que cette poignée :
+ *        la comparaison de deux identifiants devient une comparaison d'entiers et
+ *        une copie de Processus n'alloue plus de chaîne. Le texte n'est retrouvé
+ *        qu'à l'affichage, par nom().
+ *
+ *        Internement et consultation sont protégés par un verrou ; taille() se lit
+ *        sans verrou et sert aux préconditions des constructeurs.
+ *
+ * \invariant m_noms.size() == m_index.size() == taille()
+ */
+class TableIdentifiants {
+public:
+    static TableIdentifiants& globale();
+
+    uint32_t interner(const std::string& p_id);
+    std::string nom(uint32_t pid) const;
+    size_t taille() const;
+
+private:
+    TableIdentifiants();
+    TableIdentifiants(const TableIdentifiants&) = delete;
+    TableIdentifiants& operator=(const TableIdentifiants&) = delete;
+
+    mutable std::mutex m_verrou;
+    std::unordered_map<std::string, uint32_t> m_index;
+    std::vector<std::string> m_noms;
+    std::atomic<size_t> m_taille;
+
+    void verifieInvariant() const;
+};
+
+#endif // TABLEIDENTIFIANTS_H
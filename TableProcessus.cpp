@@ -0,0 +1,559 @@
+#include "TableProcessus.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include "ContratException.h"
+#include "TableIdentifiants.h"
+
+/**
+ * \brief Constructeur d'une vue sur une ligne de table.
+ * \param[in] table La table visée.
+ * \param[in] index L'indice de la ligne.
+ * \pre index < table.taille()
+ */
+RefProcessus::RefProcessus(TableProcessus& table, uint32_t index) : m_table(&table), m_index(index) {
+    PRECONDITION(index < table.taille());
+}
+
+/**
+ * \brief Retourne l'indice de la ligne dans la table.
+ */
+uint32_t RefProcessus::getIndex() const {
+    return m_index;
+}
+
+/**
+ * \brief Retourne l'identifiant textuel du processus.
+ */
+std::string RefProcessus::getId() const {
+    return m_table->getId(m_index);
+}
+
+/**
+ * \brief Retourne la poignée de l'identifiant du processus.
+ */
+uint32_t RefProcessus::getPid() const {
+    return m_table->m_pid[m_index];
+}
+
+/**
+ * \brief Retourne le temps d'arrivée du processus.
+ */
+int RefProcessus::getArrivee() const {
+    return m_table->m_arrivee[m_index];
+}
+
+/**
+ * \brief Retourne la durée totale d'exécution du processus.
+ */
+int RefProcessus::getDuree() const {
+    return m_table->m_duree[m_index];
+}
+
+/**
+ * \brief Retourne le temps restant d'exécution du processus.
+ */
+int RefProcessus::getRestant() const {
+    return m_table->m_restant[m_index];
+}
+
+/**
+ * \brief Retourne le temps d'attente du processus.
+ */
+int RefProcessus::getAttente() const {
+    return m_table->m_attente[m_index];
+}
+
+/**
+ * \brief Retourne le temps de fin du processus.
+ */
+int RefProcessus::getFin() const {
+    return m_table->m_fin[m_index];
+}
+
+/**
+ * \brief Retourne la priorité du processus.
+ */
+int RefProcessus::getPriorite() const {
+    return m_table->m_priorite[m_index];
+}
+
+/**
+ * \brief Retourne le type du processus.
+ */
+TypeProcessus RefProcessus::getType() const {
+    return m_table->m_type[m_index];
+}
+
+/**
+ * \brief Retourne l'échéance du processus, ou Processus::AUCUNE_ECHEANCE.
+ */
+int RefProcessus::getEcheance() const {
+    return m_table->m_echeance[m_index];
+}
+
+/**
+ * \brief Met à jour le temps restant du processus.
+ * \param[in] restant Temps restant à exécuter.
+ * \pre restant >= 0
+ */
+void RefProcessus::setRestant(int restant) {
+    PRECONDITION(restant >= 0);
+    m_table->m_restant[m_index] = restant;
+}
+
+/**
+ * \brief Met à jour le temps d'attente du processus.
+ * \param[in] attente Le nouveau temps d'attente.
+ * \pre attente >= 0
+ */
+void RefProcessus::setAttente(int attente) {
+    PRECONDITION(attente >= 0);
+    m_table->m_attente[m_index] = attente;
+}
+
+/**
+ * \brief Met à jour le temps de fin du processus.
+ * \param[in] fin Le nouveau temps de fin.
+ * \pre fin >= 0
+ */
+void RefProcessus::setFin(int fin) {
+    PRECONDITION(fin >= 0);
+    m_table->m_fin[m_index] = fin;
+}
+
+/**
+ * \brief Matérialise la ligne en objet Processus, pour l'affichage des résultats.
+ * \return Un Processus portant les mêmes valeurs, attente et fin comprises.
+ */
+Processus RefProcessus::versProcessus() const {
+    return m_table->versProcessus(m_index);
+}
+
+const uint32_t TableProcessus::SANS_RAFALES;
+
+/**
+ * \brief Constructeur d'une table vide.
+ */
+TableProcessus::TableProcessus() {
+    INVARIANTS();
+}
+
+/**
+ * \brief Construit une table à partir d'une file de processus.
+ * \param[in] f_entree La file à convertir, dans son ordre.
+ */
+TableProcessus::TableProcessus(const File<Processus>& f_entree) : TableProcessus() {
+    reserver(f_entree.taille());
+    for (const Processus& p : f_entree) {
+        uint32_t i = ajouter(p.getPid(), p.getArrivee(), p.getDuree(), p.getPriorite(), p.getType(),
+                             p.getEcheance());
+        if (p.aEntreesSorties()) definirRafales(i, p.getRafales());
+        m_restant[i] = p.getRestant();
+    }
+}
+
+/**
+ * \brief Ajoute un processus à la fin de la table, en internant son identifiant.
+ * \param[in] p_id Identifiant du processus.
+ * \param[in] p_arrivee Temps d'arrivée.
+ * \param[in] p_duree Durée totale d'exécution.
+ * \param[in] p_priorite Priorité.
+ * \param[in] p_type Type du processus.
+ * \param[in] p_echeance Échéance, ou Processus::AUCUNE_ECHEANCE.
+ * \return L'indice de la nouvelle ligne.
+ * \pre Mêmes conditions que le constructeur de Processus.
+ */
+uint32_t TableProcessus::ajouter(const std::string& p_id, int p_arrivee, int p_duree, int p_priorite,
+                                 TypeProcessus p_type, int p_echeance) {
+    return ajouter(TableIdentifiants::globale().interner(p_id), p_arrivee, p_duree, p_priorite, p_type,
+                   p_echeance);
+}
+
+/**
+ * \brief Ajoute un processus à la fin de la table.
+ * \param[in] p_pid Poignée de l'identifiant, déjà interné.
+ * \param[in] p_arrivee Temps d'arrivée.
+ * \param[in] p_duree Durée totale d'exécution.
+ * \param[in] p_priorite Priorité.
+ * \param[in] p_type Type du processus.
+ * \param[in] p_echeance Échéance, ou Processus::AUCUNE_ECHEANCE.
+ * \return L'indice de la nouvelle ligne.
+ * \pre Mêmes conditions que le constructeur de Processus.
+ */
+uint32_t TableProcessus::ajouter(uint32_t p_pid, int p_arrivee, int p_duree, int p_priorite,
+                                 TypeProcessus p_type, int p_echeance) {
+    PRECONDITION(p_pid < TableIdentifiants::globale().taille());
+    PRECONDITION(p_arrivee >= 0);
+    PRECONDITION(p_duree > 0);
+    PRECONDITION(p_priorite >= 0);
+    PRECONDITION(p_echeance >= 0 || p_echeance == Processus::AUCUNE_ECHEANCE);
+
+    uint32_t index = static_cast<uint32_t>(m_arrivee.size());
+    m_pid.push_back(p_pid);
+    m_arrivee.push_back(p_arrivee);
+    m_duree.push_back(p_duree);
+    m_restant.push_back(p_duree);
+    m_priorite.push_back(p_priorite);
+    m_type.push_back(p_type);
+    m_attente.push_back(0);
+    m_fin.push_back(0);
+    m_echeance.push_back(p_echeance);
+    m_debutRafales.push_back(SANS_RAFALES);
+
+    return index;
+}
+
+/**
+ * \brief Remplace la durée d'un processus par une suite de rafales (voir Processus::setRafales()).
+ * \param[in] index Indice du processus.
+ * \param[in] rafales Calcul, entrée-sortie, calcul, ..., commençant et finissant par du calcul.
+ * \pre index < taille(), le processus n'a pas commencé et n'a pas encore de rafales.
+ * \pre rafales.size() est impair, chaque rafale > 0.
+ * \post durée et restant valent la somme des rafales de calcul.
+ */
+void TableProcessus::definirRafales(uint32_t index, const std::vector<int>& rafales) {
+    PRECONDITION(index < taille());
+    PRECONDITION(m_restant[index] == m_duree[index]);
+    PRECONDITION(m_debutRafales[index] == SANS_RAFALES);
+    PRECONDITION(rafales.size() % 2 == 1);
+    PRECONDITION(std::all_of(rafales.begin(), rafales.end(), [](int r) { return r > 0; }));
+
+    int calcul = 0;
+    for (size_t k = 0; k < rafales.size(); k += 2) calcul += rafales[k];
+    m_duree[index] = calcul;
+    m_restant[index] = calcul;
+    if (rafales.size() > 1) {
+        m_debutRafales[index] = static_cast<uint32_t>(m_rafales.size());
+        m_rafales.push_back(static_cast<int>(rafales.size()));
+        m_rafales.insert(m_rafales.end(), rafales.begin(), rafales.end());
+    }
+    POSTCONDITION(nombreRafales(index) == rafales.size());
+}
+
+/**
+ * \brief Réserve la mémoire des colonnes.
+ * \param[in] nombre Nombre de processus prévus.
+ */
+void TableProcessus::reserver(size_t nombre) {
+    m_pid.reserve(nombre);
+    m_arrivee.reserve(nombre);
+    m_duree.reserve(nombre);
+    m_restant.reserve(nombre);
+    m_priorite.reserve(nombre);
+    m_type.reserve(nombre);
+    m_attente.reserve(nombre);
+    m_fin.reserve(nombre);
+    m_echeance.reserve(nombre);
+    m_debutRafales.reserve(nombre);
+}
+
+/**
+ * \brief Donne une vue sur une ligne.
+ * \param[in] index Indice de la ligne.
+ * \pre index < taille()
+ */
+RefProcessus TableProcessus::operator[](uint32_t index) {
+    return RefProcessus(*this, index);
+}
+
+/**
+ * \brief Matérialise une ligne en objet Processus, pour l'affichage des résultats.
+ * \param[in] index Indice de la ligne.
+ * \return Un Processus portant les mêmes valeurs, attente et fin comprises.
+ * \pre index < taille()
+ */
+Processus TableProcessus::versProcessus(uint32_t index) const {
+    PRECONDITION(index < taille());
+    Processus p(m_pid[index], m_arrivee[index], m_duree[index], m_priorite[index], m_type[index],
+                m_echeance[index]);
+    if (nombreRafales(index) > 1) p.setRafales(rafales(index));
+    p.setRestant(m_restant[index]);
+    p.setAttente(m_attente[index]);
+    p.setFin(m_fin[index]);
+    return p;
+}
+
+/**
+ * \brief Nombre de processus dans la table.
+ */
+size_t TableProcessus::taille() const {
+    return m_arrivee.size();
+}
+
+/**
+ * \brief Vérifie si la table est vide.
+ */
+bool TableProcessus::estVide() const {
+    return taille() == 0;
+}
+
+/**
+ * \brief Retrouve l'identifiant textuel d'un processus.
+ * \param[in] index Indice de la ligne.
+ * \pre index < taille()
+ */
+std::string TableProcessus::getId(uint32_t index) const {
+    PRECONDITION(index < taille());
+    return TableIdentifiants::globale().nom(m_pid[index]);
+}
+
+/**
+ * \brief Colonne des poignées d'identifiants.
+ */
+const std::vector<uint32_t>& TableProcessus::pids() const {
+    return m_pid;
+}
+
+/**
+ * \brief Colonne des temps d'arrivée.
+ */
+const std::vector<int>& TableProcessus::arrivees() const {
+    return m_arrivee;
+}
+
+/**
+ * \brief Colonne des durées.
+ */
+const std::vector<int>& TableProcessus::durees() const {
+    return m_duree;
+}
+
+/**
+ * \brief Colonne des temps restants.
+ */
+const std::vector<int>& TableProcessus::restants() const {
+    return m_restant;
+}
+
+/**
+ * \brief Colonne des priorités.
+ */
+const std::vector<int>& TableProcessus::priorites() const {
+    return m_priorite;
+}
+
+/**
+ * \brief Colonne des types.
+ */
+const std::vector<TypeProcessus>& TableProcessus::types() const {
+    return m_type;
+}
+
+/**
+ * \brief Colonne des temps d'attente.
+ */
+const std::vector<int>& TableProcessus::attentes() const {
+    return m_attente;
+}
+
+/**
+ * \brief Colonne des temps de fin.
+ */
+const std::vector<int>& TableProcessus::fins() const {
+    return m_fin;
+}
+
+/**
+ * \brief Colonne des échéances (Processus::AUCUNE_ECHEANCE pour les processus qui n'en ont pas).
+ */
+const std::vector<int>& TableProcessus::echeances() const {
+    return m_echeance;
+}
+
+/**
+ * \brief Vérifie si un processus au moins fait des entrées-sorties.
+ */
+bool TableProcessus::aDesEntreesSorties() const {
+    return !m_rafales.empty();
+}
+
+/**
+ * \brief Nombre de rafales d'un processus, 1 pour un processus de pur calcul.
+ * \param[in] index Indice du processus.
+ * \pre index < taille()
+ */
+size_t TableProcessus::nombreRafales(uint32_t index) const {
+    PRECONDITION(index < taille());
+    uint32_t debut = m_debutRafales[index];
+    return debut == SANS_RAFALES ? 1 : static_cast<size_t>(m_rafales[debut]);
+}
+
+/**
+ * \brief Rafale k d'un processus : du calcul pour k pair, une entrée-sortie pour k impair.
+ * \param[in] index Indice du processus.
+ * \param[in] k Rang de la rafale.
+ * \pre index < taille(), k < nombreRafales(index)
+ */
+int TableProcessus::rafale(uint32_t index, size_t k) const {
+    PRECONDITION(k < nombreRafales(index));
+    uint32_t debut = m_debutRafales[index];
+    return debut == SANS_RAFALES ? m_duree[index] : m_rafales[debut + 1 + k];
+}
+
+/**
+ * \brief Temps total qu'un processus passe en entrée-sortie.
+ * \param[in] index Indice du processus.
+ * \pre index < taille()
+ */
+int TableProcessus::entreesSorties(uint32_t index) const {
+    int total = 0;
+    for (size_t k = 1; k < nombreRafales(index); k += 2) total += rafale(index, k);
+    return total;
+}
+
+/**
+ * \brief Toutes les rafales d'un processus, {durée} pour un processus de pur calcul.
+ * \param[in] index Indice du processus.
+ * \pre index < taille()
+ */
+std::vector<int> TableProcessus::rafales(uint32_t index) const {
+    std::vector<int> resultat(nombreRafales(index));
+    for (size_t k = 0; k < resultat.size(); ++k) resultat[k] = rafale(index, k);
+    return resultat;
+}
+
+/**
+ * \brief Calcule le temps d'attente moyen à partir de la colonne des attentes.
+ * \return La moyenne, ou 0 si la table est vide.
+ */
+double TableProcessus::tempsAttenteMoyen() const {
+    if (estVide()) return 0;
+    long long somme = 0;
+    for (int attente : m_attente) somme += attente;
+    return static_cast<double>(somme) / static_cast<double>(taille());
+}
+
+/**
+ * \brief Plus long temps d'attente de la table.
+ * \return Ce maximum, ou 0 si la table est vide.
+ */
+int TableProcessus::attenteMax() const {
+    if (estVide()) return 0;
+    return *std::max_element(m_attente.begin(), m_attente.end());
+}
+
+/**
+ * \brief Percentile des temps d'attente, par sélection en O(n).
+ * \param[in] p Le rang voulu, de 0 (minimum) à 100 (maximum) ; 99 pour le p99.
+ * \return La plus petite attente dont au moins p % des processus ne dépassent
+ *         pas la valeur, ou 0 si la table est vide.
+ * \pre 0 <= p <= 100
+ */
+int TableProcessus::attentePercentile(double p) const {
+    PRECONDITION(p >= 0 && p <= 100);
+    if (estVide()) return 0;
+    std::vector<int> attentes(m_attente);
+    size_t rang = static_cast<size_t>(std::ceil(p / 100.0 * static_cast<double>(taille())));
+    size_t k = rang == 0 ? 0 : rang - 1;
+    std::nth_element(attentes.begin(), attentes.begin() + k, attentes.end());
+    return attentes[k];
+}
+
+/**
+ * \brief Bilan des échéances : taux d'échéances manquées et histogramme des retards.
+ * \param[in] largeurClasse La largeur d'une classe de l'histogramme.
+ * \param[in] classes Le nombre de classes ; la dernière est ouverte.
+ * \return Le bilan, calculé en O(n) sur les processus qui ont une échéance.
+ * \pre largeurClasse > 0, classes > 0
+ */
+BilanEcheances TableProcessus::bilanEcheances(int largeurClasse, size_t classes) const {
+    PRECONDITION(largeurClasse > 0);
+    PRECONDITION(classes > 0);
+    BilanEcheances bilan{0, 0, 0, 0, largeurClasse, std::vector<size_t>(classes, 0)};
+    for (size_t i = 0; i < taille(); ++i) {
+        if (m_echeance[i] == Processus::AUCUNE_ECHEANCE) continue;
+        ++bilan.avecEcheance;
+        int retard = m_fin[i] - m_echeance[i];
+        if (retard <= 0) continue;
+        ++bilan.manquees;
+        bilan.retardTotal += retard;
+        bilan.retardMax = std::max(bilan.retardMax, retard);
+        size_t classe = static_cast<size_t>((retard - 1) / largeurClasse);
+        ++bilan.histogramme[std::min(classe, classes - 1)];
+    }
+    return bilan;
+}
+
+/**
+ * \brief Bilan des échéances, la largeur des classes étant choisie pour que le plus
+ *        grand retard tombe dans la dernière.
+ * \param[in] classes Le nombre de classes.
+ * \pre classes > 0
+ */
+BilanEcheances TableProcessus::bilanEcheances(size_t classes) const {
+    PRECONDITION(classes > 0);
+    int retardMax = 0;
+    for (size_t i = 0; i < taille(); ++i) {
+        if (m_echeance[i] != Processus::AUCUNE_ECHEANCE) retardMax = std::max(retardMax, m_fin[i] - m_echeance[i]);
+    }
+    int n = static_cast<int>(classes);
+    return bilanEcheances(std::max(1, (retardMax + n - 1) / n), classes);
+}
+
+/**
+ * \brief Matérialise des lignes en File<Processus>, pour l'affichage.
+ * \param[in] ordre Les indices des lignes à produire, dans l'ordre voulu.
+ * \return La file des processus, avec le temps d'attente moyen des lignes produites.
+ */
+File<Processus> TableProcessus::versFile(const std::vector<uint32_t>& ordre) const {
+    File<Processus> result;
+    long long somme = 0;
+    for (uint32_t i : ordre) {
+        result.insererDernier(versProcessus(i));
+        somme += m_attente[i];
+    }
+    if (!ordre.empty()) {
+        result.setTempsMoy(static_cast<float>(somme) / static_cast<float>(ordre.size()));
+    }
+    return result;
+}
+
+/**
+ * \brief Vérifie l'invariant de la classe TableProcessus.
+ *
+ * L'invariant de cette classe s'assure que :
+ * - Toutes les colonnes ont la même taille.
+ */
+void TableProcessus::verifieInvariant() const {
+    INVARIANT(m_pid.size() == taille());
+    INVARIANT(m_duree.size() == taille());
+    INVARIANT(m_restant.size() == taille());
+    INVARIANT(m_priorite.size() == taille());
+    INVARIANT(m_type.size() == taille());
+    INVARIANT(m_attente.size() == taille());
+    INVARIANT(m_fin.size() == taille());
+    INVARIANT(m_echeance.size() == taille());
+    INVARIANT(m_debutRafales.size() == taille());
+}
+
+/**
+ * \brief Part des processus à échéance qui l'ont manquée.
+ * \return Ce taux, de 0 à 1, ou 0 si aucun processus n'a d'échéance.
+ */
+double BilanEcheances::tauxManque() const {
+    return avecEcheance == 0 ? 0 : static_cast<double>(manquees) / static_cast<double>(avecEcheance);
+}
+
+/**
+ * \brief Résumé et histogramme des retards, une ligne par classe.
+ */
+std::string BilanEcheances::toString() const {
+    std::ostringstream os;
+    os << "Echeances : " << avecEcheance << ", manquees : " << manquees << " (" << std::fixed
+       << std::setprecision(1) << 100 * tauxManque() << " %), retard moyen : " << std::setprecision(2)
+       << (manquees == 0 ? 0.0 : static_cast<double>(retardTotal) / static_cast<double>(manquees))
+       << ", retard max : " << retardMax << std::endl;
+    for (size_t k = 0; k < histogramme.size(); ++k) {
+        std::ostringstream classe;
+        classe << "]" << k * largeurClasse << ", ";
+        if (k + 1 < histogramme.size()) {
+            classe << (k + 1) * largeurClasse << "]";
+        } else {
+            classe << "+inf[";
+        }
+        os << std::setw(16) << classe.str() << " " << histogramme[k] << std::endl;
+    }
+    return os.str();
+}
@@ -0,0 +1,149 @@
+#ifndef TABLEPROCESSUS_H
+#define TABLEPROCESSUS_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "File.h"
+#include "Processus.h"
+
+class TableProcessus;
+
+/**
+ * \brief Respect des échéances, pour les processus qui en ont une.
+ *
+ *        Le retard d'un processus est fin − échéance ; il a manqué son échéance si
+ *        ce retard est positif. histogramme[k] compte les échéances manquées avec
+ *        un retard dans ]k × largeurClasse, (k + 1) × largeurClasse], la dernière
+ *        classe comptant aussi tous les retards plus grands.
+ */
+struct BilanEcheances {
+  size_t avecEcheance;
+  size_t manquees;
+  long long retardTotal;     ///< Somme des retards positifs.
+  int retardMax;
+  int largeurClasse;
+  std::vector<size_t> histogramme;
+
+  double tauxManque() const;
+  std::string toString() const;
+};
+
+/**
+ * \class RefProcessus
+ * \brief Vue légère sur une ligne d'une TableProcessus.
+ *
+ *        Offre les mêmes accesseurs que Processus sans matérialiser d'objet :
+ *        chaque appel lit ou écrit directement la colonne correspondante.
+ *        Une RefProcessus reste valide tant que la table n'est pas agrandie.
+ */
+class RefProcessus {
+public:
+    RefProcessus(TableProcessus& table, uint32_t index);
+
+    uint32_t getIndex() const;
+    std::string getId() const;
+    uint32_t getPid() const;
+    int getArrivee() const;
+    int getDuree() const;
+    int getRestant() const;
+    int getAttente() const;
+    int getFin() const;
+    int getPriorite() const;
+    TypeProcessus getType() const;
+    int getEcheance() const;
+
+    void setRestant(int restant);
+    void setAttente(int attente);
+    void setFin(int fin);
+
+    Processus versProcessus() const;
+
+private:
+    TableProcessus* m_table;
+    uint32_t m_index;
+};
+
+/**
+ * \class TableProcessus
+ * \brief Stockage en colonnes (structure de tableaux) d'un grand nombre de processus.
+ *
+ *        Chaque caractéristique d'un processus (arrivée, durée, restant, priorité,
+ *        type, attente, fin, échéance) est rangée dans son propre tableau contigu,
+ *        de même que la poignée de son identifiant interné (voir TableIdentifiants).
+ *        Un processus occupe ainsi 40 octets, sans allocation individuelle, et un
+ *        ordonnanceur qui ne lit que les arrivées et les durées ne charge que ces
+ *        deux colonnes en cache.
+ *
+ *        Les rafales des processus qui font des entrées-sorties (voir
+ *        Processus::setRafales()) sont rangées bout à bout dans un seul tableau :
+ *        leur nombre, puis les rafales. La dernière colonne donne la position de
+ *        ce bloc, ou SANS_RAFALES pour un processus de pur calcul, qui n'y occupe
+ *        rien. La durée reste la somme des rafales de calcul, et restant le calcul
+ *        qu'il reste à faire, toutes rafales confondues. Construite depuis une
+ *        file, la table recopie ici les rafales que les processus ont internées
+ *        dans TableRafales : la simulation les lit sans verrou.
+ *
+ * \invariant Toutes les colonnes ont la même taille.
+ */
+class TableProcessus {
+public:
+    static const uint32_t SANS_RAFALES = static_cast<uint32_t>(-1);
+
+    TableProcessus();
+    explicit TableProcessus(const File<Processus>& f_entree);
+
+    uint32_t ajouter(const std::string& p_id, int p_arrivee, int p_duree, int p_priorite, TypeProcessus p_type,
+                     int p_echeance = Processus::AUCUNE_ECHEANCE);
+    uint32_t ajouter(uint32_t p_pid, int p_arrivee, int p_duree, int p_priorite, TypeProcessus p_type,
+                     int p_echeance = Processus::AUCUNE_ECHEANCE);
+    void definirRafales(uint32_t index, const std::vector<int>& rafales);
+    void reserver(size_t nombre);
+
+    RefProcessus operator[](uint32_t index);
+    Processus versProcessus(uint32_t index) const;
+    size_t taille() const;
+    bool estVide() const;
+
+    std::string getId(uint32_t index) const;
+    const std::vector<uint32_t>& pids() const;
+    const std::vector<int>& arrivees() const;
+    const std::vector<int>& durees() const;
+    const std::vector<int>& restants() const;
+    const std::vector<int>& priorites() const;
+    const std::vector<TypeProcessus>& types() const;
+    const std::vector<int>& attentes() const;
+    const std::vector<int>& fins() const;
+    const std::vector<int>& echeances() const;
+
+    bool aDesEntreesSorties() const;
+    size_t nombreRafales(uint32_t index) const;
+    int rafale(uint32_t index, size_t k) const;
+    int entreesSorties(uint32_t index) const;
+    std::vector<int> rafales(uint32_t index) const;
+
+    double tempsAttenteMoyen() const;
+    int attenteMax() const;
+    int attentePercentile(double p) const;
+    BilanEcheances bilanEcheances(int largeurClasse, size_t classes) const;
+    BilanEcheances bilanEcheances(size_t classes) const;
+    File<Processus> versFile(const std::vector<uint32_t>& ordre) const;
+
+private:
+    std::vector<uint32_t> m_pid;
+    std::vector<int> m_arrivee;
+    std::vector<int> m_duree;
+    std::vector<int> m_restant;
+    std::vector<int> m_priorite;
+    std::vector<TypeProcessus> m_type;
+    std::vector<int> m_attente;
+    std::vector<int> m_fin;
+    std::vector<int> m_echeance;
+    std::vector<uint32_t> m_debutRafales;
+    std::vector<int> m_rafales;
+
+    friend class RefProcessus;
+    void verifieInvariant() const;
+};
+
+#endif // TABLEPROCESSUS_H
@@ -0,0 +1,94 @@
+#include "TableRafales.h"
+#include <algorithm>
+#include "ContratException.h"
+
+const uint32_t TableRafales::SANS_RAFALES;
+
+/**
+ * \brief Constructeur d'une table vide.
+ */
+TableRafales::TableRafales() : m_taille(0) {
+}
+
+/**
+ * \brief Table partagée par tout le programme.
+ * \return L'unique instance, créée au premier appel.
+ */
+TableRafales& TableRafales::globale() {
+    static TableRafales table;
+    return table;
+}
+
+/**
+ * \brief Donne la poignée d'une suite de rafales, en l'ajoutant si elle est nouvelle.
+ * \param[in] rafales Calcul, entrée-sortie, calcul, ..., commençant et finissant par du calcul.
+ * \return La poignée de la suite ; deux appels avec la même suite donnent la même poignée.
+ * \pre rafales.size() est impair et au moins 3, chaque rafale > 0.
+ * \post rafales(poignée) == rafales
+ */
+uint32_t TableRafales::interner(const std::vector<int>& rafales) {
+    PRECONDITION(rafales.size() % 2 == 1 && rafales.size() > 1);
+    PRECONDITION(std::all_of(rafales.begin(), rafales.end(), [](int r) { return r > 0; }));
+    std::lock_guard<std::mutex> verrou(m_verrou);
+
+    auto trouve = m_index.find(rafales);
+    if (trouve != m_index.end()) {
+        return trouve->second;
+    }
+
+    uint32_t poignee = static_cast<uint32_t>(m_suites.size());
+    m_suites.push_back(rafales);
+    m_index.emplace(rafales, poignee);
+    m_taille.store(m_suites.size(), std::memory_order_release);
+
+    POSTCONDITION(m_suites[poignee] == rafales);
+    INVARIANTS();
+    return poignee;
+}
+
+/**
+ * \brief Retrouve la suite de rafales d'une poignée.
+ * \param[in] poignee La poignée.
+ * \return Les rafales : calcul, entrée-sortie, calcul, ...
+ * \pre poignee < taille()
+ */
+std::vector<int> TableRafales::rafales(uint32_t poignee) const {
+    PRECONDITION(poignee < taille());
+    std::lock_guard<std::mutex> verrou(m_verrou);
+    return m_suites[poignee];
+}
+
+/**
+ * \brief Temps total passé en entrée-sortie par une suite (somme des rafales d'entrée-sortie).
+ * \param[in] poignee La poignée.
+ * \pre poignee < taille()
+ */
+int TableRafales::entreesSorties(uint32_t poignee) const {
+    PRECONDITION(poignee < taille());
+    std::lock_guard<std::mutex> verrou(m_verrou);
+    const std::vector<int>& suite = m_suites[poignee];
+    int total = 0;
+    for (size_t k = 1; k < suite.size(); k += 2) total += suite[k];
+    return total;
+}
+
+/**
+ * \brief Nombre de suites internées.
+ */
+size_t TableRafales::taille() const {
+    return m_taille.load(std::memory_order_acquire);
+}
+
+/**
+ * \brief Vérifie l'invariant de la classe TableRafales.
+ *
+ * L'invariant de cette classe s'assure que :
+ * - Chaque suite a exactement une poignée.
+ * - Le compteur lisible sans verrou suit le nombre de suites.
+ * - La dernière suite ajoutée commence et finit par du calcul.
+ */
+void TableRafales::verifieInvariant() const {
+    INVARIANT(m_index.size() == m_suites.size());
+    INVARIANT(m_taille.load(std::memory_order_relaxed) == m_suites.size());
+    INVARIANT(m_suites.empty() || m_suites.back().size() % 2 == 1);
+}
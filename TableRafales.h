@@ -0,0 +1,51 @@
+#ifndef TABLERAFALES_H
+#define TABLERAFALES_H
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+/**
+ * \class TableRafales
+ * \brief Table d'internement des suites de rafales des processus (voir Processus::setRafales()).
+ *
+ *        Comme pour TableIdentifiants, chaque suite reçoit une poignée entière
+ *        dense et un Processus ne transporte que cette poignée : sa taille ne
+ *        dépend pas de ses rafales et sa copie n'alloue rien. Deux processus aux
+ *        mêmes rafales partagent la même poignée. Les ordonnanceurs n'y touchent
+ *        pas : TableProcessus recopie les rafales dans ses propres colonnes à la
+ *        construction, et les réinterne dans versProcessus().
+ *
+ *        Internement et consultation sont protégés par un verrou ; taille() se lit
+ *        sans verrou et sert à l'invariant de Processus.
+ *
+ * \invariant m_suites.size() == m_index.size() == taille()
+ * \invariant Chaque suite a au moins trois rafales, en nombre impair.
+ */
+class TableRafales {
+public:
+    static const uint32_t SANS_RAFALES = UINT32_MAX;
+
+    static TableRafales& globale();
+
+    uint32_t interner(const std::vector<int>& rafales);
+    std::vector<int> rafales(uint32_t poignee) const;
+    int entreesSorties(uint32_t poignee) const;
+    size_t taille() const;
+
+private:
+    TableRafales();
+    TableRafales(const TableRafales&) = delete;
+    TableRafales& operator=(const TableRafales&) = delete;
+
+    mutable std::mutex m_verrou;
+    std::map<std::vector<int>, uint32_t> m_index;
+    std::vector<std::vector<int>> m_suites;
+    std::atomic<size_t> m_taille;
+
+    void verifieInvariant() const;
+};
+
+#endif // TABLERAFALES_H
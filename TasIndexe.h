@@ -0,0 +1,374 @@
+//
+// Created by Vincent on 10/1/2024.
+//
+
+#ifndef TASINDEXE_H
+#define TASINDEXE_H
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+#include "ContratException.h"
+
+/**
+ * \brief Tas d-aire indexé : file de priorité avec poignées stables.
+ *
+ *        Chaque insertion retourne une poignée qui permet ensuite de consulter,
+ *        modifier (diminution ou augmentation de clé) ou retirer l'élément en
+ *        O(D log_D n), sans le rechercher. Le sommet est l'élément e pour lequel
+ *        aucun autre élément x ne vérifie comp(x, e). À égalité, l'élément inséré
+ *        le plus tôt sort en premier : le tas est stable.
+ *
+ * \tparam T Type des éléments stockés.
+ * \tparam Comparateur comp(a, b) vrai si a doit sortir avant b (std::less : tas-min).
+ * \tparam D Arité du tas (4 par défaut, plus favorable au cache qu'un tas binaire).
+ */
+template <typename T, typename Comparateur = std::less<T>, size_t D = 4>
+class TasIndexe {
+public:
+  typedef size_t Poignee;
+
+  explicit TasIndexe(const Comparateur& comp = Comparateur());
+
+  Poignee inserer(const T& valeur);
+  Poignee inserer(T&& valeur);
+
+  const T& sommet() const;
+  Poignee poigneeSommet() const;
+  T extraireSommet();
+
+  const T& getValeur(Poignee poignee) const;
+  void modifier(Poignee poignee, const T& valeur);
+  void supprimer(Poignee poignee);
+  bool contient(Poignee poignee) const;
+
+  void reserver(size_t capacite);
+  size_t taille() const;
+  bool estVide() const;
+
+private:
+  struct Entree {
+    T valeur;
+    Poignee poignee;
+    unsigned long long sequence;
+  };
+
+  static const size_t ABSENT = static_cast<size_t>(-1);
+
+  std::vector<Entree> m_tas;
+  std::vector<size_t> m_position;
+  std::vector<Poignee> m_libres;
+  unsigned long long m_sequence;
+  Comparateur m_comp;
+  // Toujours présent : la disposition de la classe ne dépend pas de VERIFICATION_STRUCTURES.
+  size_t m_modifications;
+
+  Poignee ajouter(Entree&& entree);
+  bool avant(size_t i, size_t j) const;
+  void placer(size_t i, Entree&& entree);
+  void monter(size_t i);
+  void descendre(size_t i);
+  void retirerA(size_t i);
+  void verifier();
+  bool invariantLocal() const;
+  bool invariant() const;
+};
+
+
+template<typename T, typename Comparateur, size_t D>
+const size_t TasIndexe<T, Comparateur, D>::ABSENT;
+
+/**
+ * \brief Constructeur d'un tas vide.
+ * \param[in] comp Comparateur définissant l'ordre de sortie.
+ */
+template<typename T, typename Comparateur, size_t D>
+TasIndexe<T, Comparateur, D>::TasIndexe(const Comparateur &comp) : m_sequence(0), m_comp(comp), m_modifications(0) {
+  static_assert(D >= 2, "Un tas doit avoir une arite d'au moins 2");
+}
+
+/**
+ * \brief Insère un élément dans le tas.
+ * \param[in] valeur L'élément à insérer.
+ * \return La poignée de l'élément, valide jusqu'à son retrait.
+ */
+template<typename T, typename Comparateur, size_t D>
+typename TasIndexe<T, Comparateur, D>::Poignee TasIndexe<T, Comparateur, D>::inserer(const T &valeur) {
+  return ajouter(Entree{valeur, 0, 0});
+}
+
+/**
+ * \brief Insère un élément dans le tas en le déplaçant.
+ * \param[in] valeur L'élément à insérer.
+ * \return La poignée de l'élément, valide jusqu'à son retrait.
+ */
+template<typename T, typename Comparateur, size_t D>
+typename TasIndexe<T, Comparateur, D>::Poignee TasIndexe<T, Comparateur, D>::inserer(T &&valeur) {
+  return ajouter(Entree{std::move(valeur), 0, 0});
+}
+
+/**
+ * \brief Attribue une poignée à une entrée et la remonte à sa place.
+ * \param[in] entree L'entrée à ajouter.
+ * \return La poignée attribuée (une poignée libérée est réutilisée).
+ */
+template<typename T, typename Comparateur, size_t D>
+typename TasIndexe<T, Comparateur, D>::Poignee TasIndexe<T, Comparateur, D>::ajouter(Entree &&entree) {
+  if (m_libres.empty()) {
+    entree.poignee = m_position.size();
+    m_position.push_back(ABSENT);
+  }
+  else {
+    entree.poignee = m_libres.back();
+    m_libres.pop_back();
+  }
+  entree.sequence = m_sequence++;
+  Poignee poignee = entree.poignee;
+
+  m_position[poignee] = m_tas.size();
+  m_tas.push_back(std::move(entree));
+  monter(m_tas.size() - 1);
+
+  verifier();
+  return poignee;
+}
+
+/**
+ * \brief Consulte l'élément prioritaire.
+ * \return Une référence constante vers le sommet.
+ * \pre !estVide()
+ */
+template<typename T, typename Comparateur, size_t D>
+const T& TasIndexe<T, Comparateur, D>::sommet() const {
+  PRECONDITION(!estVide());
+  return m_tas.front().valeur;
+}
+
+/**
+ * \brief Poignée de l'élément prioritaire.
+ * \pre !estVide()
+ */
+template<typename T, typename Comparateur, size_t D>
+typename TasIndexe<T, Comparateur, D>::Poignee TasIndexe<T, Comparateur, D>::poigneeSommet() const {
+  PRECONDITION(!estVide());
+  return m_tas.front().poignee;
+}
+
+/**
+ * \brief Retire et retourne l'élément prioritaire.
+ * \return Le sommet du tas.
+ * \pre !estVide()
+ * \post La poignée du sommet est libérée.
+ */
+template<typename T, typename Comparateur, size_t D>
+T TasIndexe<T, Comparateur, D>::extraireSommet() {
+  PRECONDITION(!estVide());
+  T valeur = std::move(m_tas.front().valeur);
+  retirerA(0);
+  return valeur;
+}
+
+/**
+ * \brief Consulte l'élément associé à une poignée.
+ * \param[in] poignee Poignée retournée par inserer().
+ * \pre contient(poignee)
+ */
+template<typename T, typename Comparateur, size_t D>
+const T& TasIndexe<T, Comparateur, D>::getValeur(Poignee poignee) const {
+  PRECONDITION(contient(poignee));
+  return m_tas[m_position[poignee]].valeur;
+}
+
+/**
+ * \brief Remplace la valeur d'un élément et rétablit l'ordre du tas.
+ * \param[in] poignee Poignée de l'élément.
+ * \param[in] valeur La nouvelle valeur (clé diminuée ou augmentée).
+ * \pre contient(poignee)
+ * \post La poignée reste valide ; l'ordre d'insertion sert toujours à départager.
+ */
+template<typename T, typename Comparateur, size_t D>
+void TasIndexe<T, Comparateur, D>::modifier(Poignee poignee, const T &valeur) {
+  PRECONDITION(contient(poignee));
+  size_t i = m_position[poignee];
+  m_tas[i].valeur = valeur;
+  monter(i);
+  descendre(m_position[poignee]);
+
+  verifier();
+}
+
+/**
+ * \brief Retire un élément désigné par sa poignée.
+ * \param[in] poignee Poignée de l'élément.
+ * \pre contient(poignee)
+ * \post La poignée est libérée.
+ */
+template<typename T, typename Comparateur, size_t D>
+void TasIndexe<T, Comparateur, D>::supprimer(Poignee poignee) {
+  PRECONDITION(contient(poignee));
+  retirerA(m_position[poignee]);
+}
+
+/**
+ * \brief Indique si une poignée désigne un élément présent dans le tas.
+ */
+template<typename T, typename Comparateur, size_t D>
+bool TasIndexe<T, Comparateur, D>::contient(Poignee poignee) const {
+  return poignee < m_position.size() && m_position[poignee] != ABSENT;
+}
+
+/**
+ * \brief Réserve la mémoire pour capacite éléments.
+ */
+template<typename T, typename Comparateur, size_t D>
+void TasIndexe<T, Comparateur, D>::reserver(size_t capacite) {
+  m_tas.reserve(capacite);
+  m_position.reserve(capacite);
+}
+
+/**
+ * \brief Nombre d'éléments dans le tas.
+ */
+template<typename T, typename Comparateur, size_t D>
+size_t TasIndexe<T, Comparateur, D>::taille() const {
+  return m_tas.size();
+}
+
+/**
+ * \brief Vérifie si le tas est vide.
+ */
+template<typename T, typename Comparateur, size_t D>
+bool TasIndexe<T, Comparateur, D>::estVide() const {
+  return m_tas.empty();
+}
+
+/**
+ * \brief Vrai si l'entrée i doit sortir avant l'entrée j.
+ */
+template<typename T, typename Comparateur, size_t D>
+bool TasIndexe<T, Comparateur, D>::avant(size_t i, size_t j) const {
+  const Entree& a = m_tas[i];
+  const Entree& b = m_tas[j];
+  if (m_comp(a.valeur, b.valeur)) return true;
+  if (m_comp(b.valeur, a.valeur)) return false;
+  return a.sequence < b.sequence;
+}
+
+/**
+ * \brief Place une entrée à l'indice i et met à jour sa position.
+ */
+template<typename T, typename Comparateur, size_t D>
+void TasIndexe<T, Comparateur, D>::placer(size_t i, Entree &&entree) {
+  m_position[entree.poignee] = i;
+  m_tas[i] = std::move(entree);
+}
+
+/**
+ * \brief Remonte l'entrée i tant qu'elle doit sortir avant son parent.
+ */
+template<typename T, typename Comparateur, size_t D>
+void TasIndexe<T, Comparateur, D>::monter(size_t i) {
+  while (i > 0) {
+    size_t parent = (i - 1) / D;
+    if (!avant(i, parent)) break;
+    Entree courante = std::move(m_tas[i]);
+    placer(i, std::move(m_tas[parent]));
+    placer(parent, std::move(courante));
+    i = parent;
+  }
+}
+
+/**
+ * \brief Descend l'entrée i tant qu'un de ses enfants doit sortir avant elle.
+ */
+template<typename T, typename Comparateur, size_t D>
+void TasIndexe<T, Comparateur, D>::descendre(size_t i) {
+  const size_t n = m_tas.size();
+  while (true) {
+    size_t premier = i * D + 1;
+    if (premier >= n) break;
+    size_t meilleur = premier;
+    size_t fin = premier + D < n ? premier + D : n;
+    for (size_t c = premier + 1; c < fin; ++c) {
+      if (avant(c, meilleur)) meilleur = c;
+    }
+    if (!avant(meilleur, i)) break;
+    Entree courante = std::move(m_tas[i]);
+    placer(i, std::move(m_tas[meilleur]));
+    placer(meilleur, std::move(courante));
+    i = meilleur;
+  }
+}
+
+/**
+ * \brief Retire l'entrée à l'indice i en la remplaçant par la dernière.
+ */
+template<typename T, typename Comparateur, size_t D>
+void TasIndexe<T, Comparateur, D>::retirerA(size_t i) {
+  Poignee poignee = m_tas[i].poignee;
+  size_t dernier = m_tas.size() - 1;
+  if (i != dernier) {
+    placer(i, std::move(m_tas[dernier]));
+  }
+  m_tas.pop_back();
+  m_position[poignee] = ABSENT;
+  m_libres.push_back(poignee);
+  if (i < m_tas.size()) {
+    Poignee deplacee = m_tas[i].poignee;
+    monter(i);
+    descendre(m_position[deplacee]);
+  }
+
+  verifier();
+}
+
+/**
+ * \brief Vérifie le tas après une modification, selon VERIFICATION_STRUCTURES.
+ * \throw InvariantException Si l'invariant vérifié n'est pas respecté.
+ *
+ * Voir ContratException.h : au niveau 2, le tas complet n'est revérifié
+ * qu'après taille() modifications (O(1) amorti).
+ */
+template<typename T, typename Comparateur, size_t D>
+void TasIndexe<T, Comparateur, D>::verifier() {
+#if VERIFICATION_STRUCTURES >= 3
+  VERIFIER_STRUCTURE(invariant());
+#elif VERIFICATION_STRUCTURES == 2
+  VERIFIER_STRUCTURE(invariantLocal());
+  if (++m_modifications >= m_tas.size()) {
+    m_modifications = 0;
+    VERIFIER_STRUCTURE(invariant());
+  }
+#elif VERIFICATION_STRUCTURES == 1
+  VERIFIER_STRUCTURE(invariantLocal());
+#endif
+}
+
+/**
+ * \brief Vérifie, en O(1), la cohérence des tailles et de la position du sommet.
+ */
+template<typename T, typename Comparateur, size_t D>
+bool TasIndexe<T, Comparateur, D>::invariantLocal() const {
+  if (m_tas.size() + m_libres.size() != m_position.size()) return false;
+  return m_tas.empty() || m_position[m_tas.front().poignee] == 0;
+}
+
+/**
+ * \brief Vérifie l'invariant du tas.
+ * \return Vrai si l'invariant est respecté, faux sinon.
+ *
+ * L'invariant stipule que :
+ * - Aucun enfant ne doit sortir avant son parent.
+ * - La table des positions est cohérente avec le tableau du tas.
+ */
+template<typename T, typename Comparateur, size_t D>
+bool TasIndexe<T, Comparateur, D>::invariant() const {
+  for (size_t i = 0; i < m_tas.size(); ++i) {
+    if (m_position[m_tas[i].poignee] != i) return false;
+    if (i > 0 && avant(i, (i - 1) / D)) return false;
+  }
+  return true;
+}
+
+#endif //TASINDEXE_H
@@ -0,0 +1,85 @@
+/**
+ * \file bench_Balayage.cpp
+ * \brief Durée d'un balayage de réglages, avec et sans élagage des réglages dominés.
+ *
+ *        La charge est générée comme dans bench_Ordonnanceurs. La grille couvre le
+ *        tourniquet et le multiniveaux pour chaque quantum de 1 à quantumMax, et
+ *        MLFQ pour chaque quantum et huit périodes de relèvement : 1000 réglages
+ *        avec quantumMax = 100. Affiche le tableau du balayage élagué.
+ *
+ *        Usage : bench_Balayage [nombre de processus] [quantumMax] [fils] [sans élagage : 0 ou 1]
+ */
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Balayage.h"
+#include "PoolTaches.h"
+#include "TableIdentifiants.h"
+#include "TableProcessus.h"
+
+using namespace std;
+
+namespace {
+    /**
+     * \brief Génère une table de n processus, triés par arrivée.
+     */
+    TableProcessus generer(size_t n) {
+        mt19937 generateur(2024);
+        uniform_int_distribution<int> ecart(0, 9);
+        uniform_int_distribution<int> duree(1, 20);
+        uniform_int_distribution<int> priorite(0, 9);
+        uniform_int_distribution<int> type(1, 4);
+
+        TableProcessus table;
+        table.reserver(n);
+        int arrivee = 0;
+        for (size_t i = 0; i < n; ++i) {
+            arrivee += ecart(generateur);
+            uint32_t pid = TableIdentifiants::globale().interner("p" + to_string(i));
+            table.ajouter(pid, arrivee, duree(generateur), priorite(generateur),
+                          static_cast<TypeProcessus>(type(generateur)));
+        }
+        return table;
+    }
+
+    /**
+     * \brief Balaye la grille et affiche la durée et le nombre de réglages abandonnés.
+     */
+    vector<MesureReglage> chronometrer(const string& nom, const TableProcessus& charge,
+                                       const vector<Reglage>& grille, PoolTaches& pool, bool elaguer) {
+        auto debut = chrono::steady_clock::now();
+        vector<MesureReglage> mesures = balayer(charge, grille, pool, 0, elaguer);
+        chrono::duration<double> duree = chrono::steady_clock::now() - debut;
+        size_t abandonnes = 0;
+        for (const MesureReglage& mesure : mesures) abandonnes += mesure.complet ? 0 : 1;
+        cout << nom << ": " << duree.count() << " s, " << abandonnes << " reglages abandonnes" << endl;
+        return mesures;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    size_t n = argc > 1 ? strtoul(argv[1], nullptr, 10) : 1000000;
+    int quantumMax = argc > 2 ? atoi(argv[2]) : 100;
+    size_t fils = argc > 3 ? strtoul(argv[3], nullptr, 10) : thread::hardware_concurrency();
+    bool comparer = argc > 4 && atoi(argv[4]) != 0;
+
+    vector<Reglage> grille;
+    for (int q = 1; q <= quantumMax; ++q) grille.push_back({PolitiqueBalayee::TOURNIQUET, q, 0});
+    for (int q = 1; q <= quantumMax; ++q) grille.push_back({PolitiqueBalayee::MULTINIVEAUX, q, 0});
+    for (int q = 1; q <= quantumMax; ++q) {
+        for (int r : {25, 50, 100, 200, 400, 800, 1600, 3200}) grille.push_back({PolitiqueBalayee::MLFQ, q, r});
+    }
+
+    TableProcessus charge = generer(n);
+    PoolTaches pool(fils);
+    cout << "processus: " << n << ", reglages: " << grille.size() << ", fils: " << pool.taille() << endl;
+
+    if (comparer) chronometrer("sans elagage", charge, grille, pool, false);
+    vector<MesureReglage> mesures = chronometrer("avec elagage", charge, grille, pool, true);
+    cout << formaterBalayage(mesures);
+    return 0;
+}
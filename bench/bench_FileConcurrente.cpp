@@ -0,0 +1,100 @@
+/**
+ * \file bench_FileConcurrente.cpp
+ * \brief Débit de FileConcurrente comparé à une File protégée par un mutex.
+ *
+ *        Pour 1 à 32 producteurs, chaque producteur insère sa part d'un total
+ *        fixe d'éléments pendant qu'un consommateur unique les retire. Les deux
+ *        files utilisent AllocateurStandard pour ne comparer que la synchronisation.
+ *
+ *        Usage : bench_FileConcurrente [nombre total d'éléments]
+ */
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "File.h"
+#include "FileConcurrente.h"
+
+using namespace std;
+
+namespace {
+    /**
+     * \brief File<T> dont chaque opération prend un verrou : la référence à battre.
+     */
+    class FileVerrouillee {
+    public:
+        void insererDernier(long valeur) {
+            lock_guard<mutex> garde(m_verrou);
+            m_file.insererDernier(valeur);
+        }
+
+        bool extrairePremier(long& sortie) {
+            lock_guard<mutex> garde(m_verrou);
+            if (m_file.estVide()) return false;
+            sortie = m_file.getValeur(0);
+            m_file.supprimerPremier();
+            return true;
+        }
+
+    private:
+        mutex m_verrou;
+        File<long, StockageChaine, AllocateurStandard> m_file;
+    };
+
+    /**
+     * \brief Mesure le débit d'une file pour un nombre de producteurs donné.
+     * \return Millions d'éléments transférés par seconde.
+     */
+    template <typename FileT>
+    double mesurer(int producteurs, long total) {
+        FileT file;
+        long parProducteur = total / producteurs;
+        long attendu = parProducteur * producteurs;
+
+        auto debut = chrono::steady_clock::now();
+        vector<thread> fils;
+        for (int p = 0; p < producteurs; ++p) {
+            fils.emplace_back([&file, parProducteur]() {
+                for (long i = 0; i < parProducteur; ++i) file.insererDernier(i);
+            });
+        }
+
+        long recus = 0;
+        long somme = 0;
+        long valeur = 0;
+        while (recus < attendu) {
+            if (file.extrairePremier(valeur)) {
+                somme += valeur;
+                ++recus;
+            }
+        }
+        for (auto& fil : fils) fil.join();
+        chrono::duration<double> duree = chrono::steady_clock::now() - debut;
+
+        if (somme != producteurs * (parProducteur * (parProducteur - 1) / 2)) {
+            cerr << "Somme incorrecte pour " << producteurs << " producteurs" << endl;
+            exit(1);
+        }
+        return attendu / duree.count() / 1e6;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    long total = argc > 1 ? atol(argv[1]) : 4000000;
+
+    cout << "elements: " << total << endl;
+    cout << setw(12) << "producteurs" << setw(16) << "mutex (M/s)" << setw(16) << "MPSC (M/s)"
+         << setw(10) << "gain" << endl;
+
+    for (int producteurs = 1; producteurs <= 32; producteurs *= 2) {
+        double verrou = mesurer<FileVerrouillee>(producteurs, total);
+        double sansVerrou = mesurer<FileConcurrente<long>>(producteurs, total);
+        cout << fixed << setprecision(2)
+             << setw(12) << producteurs << setw(16) << verrou << setw(16) << sansVerrou
+             << setw(9) << sansVerrou / verrou << "x" << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,87 @@
+/**
+ * \file bench_Multicoeur.cpp
+ * \brief Compare les stratégies d'équilibrage de SimulationMulticoeur.h.
+ *
+ *        Pour chaque nombre de cœurs, une charge synthétique de graine fixe est
+ *        générée avec un débit d'arrivée proportionnel au nombre de cœurs (charge
+ *        proche de 1 par cœur), puis simulée en tourniquet et en MLFQ avec une
+ *        file globale, des files par cœur sans vol, et le vol de travail.
+ *
+ *        Usage : bench_Multicoeur [nombre de processus] [coût de migration]
+ */
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include "Politiques.h"
+#include "SimulationMulticoeur.h"
+#include "TableIdentifiants.h"
+#include "TableProcessus.h"
+
+using namespace std;
+
+namespace {
+    /**
+     * \brief Génère n processus dont les arrivées suivent un processus de Poisson de débit coeurs / 10.
+     */
+    TableProcessus generer(size_t n, int coeurs) {
+        mt19937 generateur(2024);
+        exponential_distribution<double> ecart(coeurs / 10.0);
+        uniform_int_distribution<int> duree(1, 18);
+        uniform_int_distribution<int> priorite(0, 9);
+        uniform_int_distribution<int> type(1, 4);
+
+        TableProcessus table;
+        table.reserver(n);
+        double arrivee = 0;
+        for (size_t i = 0; i < n; ++i) {
+            arrivee += ecart(generateur);
+            uint32_t pid = TableIdentifiants::globale().interner("p" + to_string(i));
+            table.ajouter(pid, static_cast<int>(arrivee), duree(generateur), priorite(generateur),
+                          static_cast<TypeProcessus>(type(generateur)));
+        }
+        return table;
+    }
+
+    /**
+     * \brief Simule une copie de la table et affiche une ligne de mesures.
+     */
+    template <typename Fabrique>
+    void mesurer(const string& nom, const TableProcessus& source, const ConfigMulticoeur& config, Fabrique fabrique) {
+        static const char* const NOMS[] = {"globale", "par coeur", "vol"};
+        TableProcessus table = source;
+        auto debut = chrono::steady_clock::now();
+        StatistiquesMulticoeur stats = simulerMulticoeur(table, fabrique(table), config, 0);
+        chrono::duration<double, milli> duree = chrono::steady_clock::now() - debut;
+        cout << fixed << setprecision(2)
+             << setw(8) << config.coeurs << setw(8) << nom << setw(11) << NOMS[static_cast<int>(config.equilibrage)]
+             << setw(12) << duree.count() << setw(12) << table.tempsAttenteMoyen()
+             << setw(10) << table.attentePercentile(99) << setw(8) << stats.utilisationMoyenne()
+             << setw(8) << stats.desequilibre() << setw(12) << stats.migrations << setw(10) << stats.vols << endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    size_t n = argc > 1 ? strtoul(argv[1], nullptr, 10) : 200000;
+    int cout_migration = argc > 2 ? atoi(argv[2]) : 1;
+
+    cout << "processus: " << n << ", cout de migration: " << cout_migration << endl;
+    cout << setw(8) << "coeurs" << setw(8) << "pol." << setw(11) << "equil." << setw(12) << "temps (ms)"
+         << setw(12) << "att. moy." << setw(10) << "att. p99" << setw(8) << "util." << setw(8) << "desequ."
+         << setw(12) << "migrations" << setw(10) << "vols" << endl;
+
+    const Equilibrage strategies[] = {Equilibrage::FILE_GLOBALE, Equilibrage::FILES_PAR_COEUR,
+                                      Equilibrage::VOL_DE_TRAVAIL};
+    for (int coeurs = 1; coeurs <= 64; coeurs *= 4) {
+        TableProcessus table = generer(n, coeurs);
+        for (Equilibrage equilibrage : strategies) {
+            ConfigMulticoeur config{coeurs, equilibrage, cout_migration};
+            mesurer("rr", table, config, [](TableProcessus&) { return PolitiqueTourniquet(4); });
+            mesurer("mlfq", table, config,
+                    [](TableProcessus& t) { return PolitiqueMlfq(t, {4, 8, 16, 32}, 400); });
+        }
+    }
+    return 0;
+}
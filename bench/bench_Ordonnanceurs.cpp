@@ -0,0 +1,95 @@
+/**
+ * \file bench_Ordonnanceurs.cpp
+ * \brief Temps d'exécution des ordonnanceurs sur table pour une charge synthétique.
+ *
+ *        La charge est générée avec une graine fixe : arrivées espacées de 0 à
+ *        9 unités, durées de 1 à 20, priorités de 0 à 9 et types répartis
+ *        uniformément ; chaque processus a une échéance, de 0 à 40 unités après
+ *        la fin qu'il aurait seul sur le processeur. Chaque ordonnanceur travaille sur sa propre copie de la
+ *        table ; seule la simulation est chronométrée.
+ *
+ *        Usage : bench_Ordonnanceurs [nombre de processus] [quantum] [période de vieillissement]
+ */
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include "Ordonnanceur.h"
+#include "TableIdentifiants.h"
+#include "TableProcessus.h"
+
+using namespace std;
+
+namespace {
+    /**
+     * \brief Génère une table de n processus, triés par arrivée.
+     */
+    TableProcessus generer(size_t n) {
+        mt19937 generateur(2024);
+        uniform_int_distribution<int> ecart(0, 9);
+        uniform_int_distribution<int> duree(1, 20);
+        uniform_int_distribution<int> priorite(0, 9);
+        uniform_int_distribution<int> type(1, 4);
+        mt19937 generateurEcheances(7);
+        uniform_int_distribution<int> marge(0, 40);
+
+        TableProcessus table;
+        table.reserver(n);
+        int arrivee = 0;
+        for (size_t i = 0; i < n; ++i) {
+            arrivee += ecart(generateur);
+            uint32_t pid = TableIdentifiants::globale().interner("p" + to_string(i));
+            int d = duree(generateur);
+            int p = priorite(generateur);
+            TypeProcessus t = static_cast<TypeProcessus>(type(generateur));
+            table.ajouter(pid, arrivee, d, p, t, arrivee + d + marge(generateurEcheances));
+        }
+        return table;
+    }
+
+    /**
+     * \brief Chronomètre un ordonnanceur sur une copie de la table et affiche une ligne.
+     */
+    void mesurer(const string& nom, const TableProcessus& source,
+                 const function<void(TableProcessus&)>& ordonnanceur) {
+        TableProcessus table = source;
+        auto debut = chrono::steady_clock::now();
+        ordonnanceur(table);
+        chrono::duration<double, milli> duree = chrono::steady_clock::now() - debut;
+        cout << fixed << setprecision(2)
+             << setw(22) << nom << setw(14) << duree.count() << setw(18) << table.tempsAttenteMoyen()
+             << setw(14) << table.attentePercentile(99) << setw(14) << table.attenteMax() << endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    size_t n = argc > 1 ? strtoul(argv[1], nullptr, 10) : 1000000;
+    int quantum = argc > 2 ? atoi(argv[2]) : 4;
+    int vieillissement = argc > 3 ? atoi(argv[3]) : 1000;
+
+    TableProcessus table = generer(n);
+
+    cout << "processus: " << n << ", quantum: " << quantum << ", vieillissement: " << vieillissement << endl;
+    cout << setw(22) << "politique" << setw(14) << "temps (ms)" << setw(18) << "attente moyenne"
+         << setw(14) << "attente p99" << setw(14) << "attente max" << endl;
+
+    mesurer("fcfs", table, [](TableProcessus& t) { TP::fcfs(t, 0); });
+    mesurer("fjs", table, [](TableProcessus& t) { TP::fjs(t, 0); });
+    mesurer("srtf", table, [](TableProcessus& t) { TP::srtf(t, 0); });
+    mesurer("round_robin", table, [quantum](TableProcessus& t) { TP::round_robin(t, quantum, 0); });
+    mesurer("priorite", table, [](TableProcessus& t) { TP::priorite(t, 0); });
+    mesurer("priorite_preemptive", table,
+            [vieillissement](TableProcessus& t) { TP::priorite_preemptive(t, vieillissement, 0); });
+    mesurer("multiniveaux", table, [quantum](TableProcessus& t) { TP::multiniveaux(t, quantum, 0); });
+    mesurer("mlfq", table, [quantum](TableProcessus& t) {
+        TP::mlfq(t, {quantum, 2 * quantum, 4 * quantum, 8 * quantum}, 100 * quantum, 0);
+    });
+    mesurer("loterie", table, [quantum](TableProcessus& t) { TP::loterie(t, quantum, 2024, 0); });
+    mesurer("stride", table, [quantum](TableProcessus& t) { TP::stride(t, quantum, 0); });
+    mesurer("edf", table, [](TableProcessus& t) { TP::edf(t, 0); });
+    mesurer("cfs", table, [quantum](TableProcessus& t) { TP::cfs(t, 6 * quantum, quantum, 0); });
+    return 0;
+}
@@ -1,9 +1,23 @@
+#include <cstdlib>
 #include <iostream>
 #include <fstream>
+#include <sstream>
+#include <string>
+#include <algorithm>
+#include <functional>
+#include <iomanip>
+#include <future>
+#include <thread>
+#include <vector>
 #include "Processus.h"
 #include "File.h"
 #include "Ordonnanceur.h"
 #include "ContratException.h"
+#include "TableIdentifiants.h"
+#include "PoolTaches.h"
+#include "Balayage.h"
+#include "Politiques.h"
+#include "TableProcessus.h"
 
 using namespace std;
 
@@ -15,21 +29,35 @@ using namespace std;
  * La ligne doit contenir les éléments suivants, séparés par des espaces :
  * - ID du processus
  * - Temps d'arrivée
- * - Durée
+ * - Durée, ou rafales séparées par des virgules, sans espace : calcul,entrée-sortie,calcul,...
+ *   (voir Processus::setRafales())
  * - Priorité
  * - Type de processus (entier)
+ * - Échéance (facultative) : l'instant avant lequel le processus devrait avoir fini
  */
 Processus chargerProcessus(const string& ligne) {
-    string id;
-    int arrivee, duree, priorite;
+    string id, duree;
+    int arrivee, priorite;
     int type;
+    int echeance;
 
     istringstream ss(ligne);
     ss >> id >> arrivee >> duree >> priorite >> type;
+    if (!(ss >> echeance)) echeance = Processus::AUCUNE_ECHEANCE;
+
+    vector<int> rafales;
+    istringstream morceaux(duree);
+    string rafale;
+    while (getline(morceaux, rafale, ',')) rafales.push_back(atoi(rafale.c_str()));
+    int calcul = 0;
+    for (size_t k = 0; k < rafales.size(); k += 2) calcul += rafales[k];
 
     TypeProcessus processusType = static_cast<TypeProcessus>(type);
+    uint32_t pid = TableIdentifiants::globale().interner(id);
 
-    return Processus(id, arrivee, duree, priorite, processusType);
+    Processus p(pid, arrivee, calcul, priorite, processusType, echeance);
+    if (rafales.size() > 1) p.setRafales(rafales);
+    return p;
 }
 
 /**
@@ -60,52 +88,278 @@ File<Processus> ChargerFile(const string& nomFichier) {
     return fileProcessus;
 }
 
+/**
+ * \brief Une simulation à lancer : la file d'entrée à afficher avant le résultat, s'il y a lieu,
+ *        le calcul du résultat et, s'il y a lieu, le bilan à afficher après.
+ */
+struct Simulation {
+    const File<Processus>* entree;
+    function<File<Processus>()> lancer;
+    function<string()> bilan;
+};
+
+/**
+ * \brief Lit l'option -j N (nombre de fils) de la ligne de commande.
+ * \return N, ou le nombre de cœurs de la machine si l'option est absente ou invalide.
+ */
+size_t lireFils(int argc, char* argv[]) {
+    size_t fils = thread::hardware_concurrency();
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (string(argv[i]) == "-j") {
+            int valeur = atoi(argv[i + 1]);
+            if (valeur > 0) fils = static_cast<size_t>(valeur);
+        }
+    }
+    return fils == 0 ? 1 : fils;
+}
+
+/**
+ * \brief Lit l'option -c BASE [RECHAUFFEMENT REFROIDISSEMENT] (coût des commutations) de la ligne de commande.
+ * \param[in] defaut Le coût à utiliser si l'option est absente.
+ * \return Le coût lu ; les valeurs omises ou négatives valent 0.
+ */
+CoutCommutation lireCommutation(int argc, char* argv[], const CoutCommutation& defaut) {
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (string(argv[i]) != "-c") continue;
+        int valeurs[3] = {0, 0, 0};
+        for (int k = 0; k < 3 && i + 1 + k < argc && argv[i + 1 + k][0] != '-'; ++k) {
+            valeurs[k] = max(atoi(argv[i + 1 + k]), 0);
+        }
+        return CoutCommutation{valeurs[0], valeurs[1], valeurs[2]};
+    }
+    return defaut;
+}
+
+/**
+ * \brief Mode balayage : évalue une grille de quanta et de périodes de relèvement sur un fichier.
+ *
+ * La grille couvre le tourniquet et le multiniveaux pour chaque quantum de 1 à
+ * quantumMax, et MLFQ pour chaque quantum et chaque période de relèvement de
+ * {25, 50, 100, 200, 400}. Le fichier est chargé une fois ; les réglages dominés
+ * sont abandonnés en cours de route (voir balayer()). Chaque commutation coûte
+ * commutation : avec un coût non nul, les petits quanta paient leurs commutations.
+ *
+ * \param[in] nomFichier Le fichier de processus, au format de `chargerProcessus`.
+ * \param[in] quantumMax Le plus grand quantum de la grille.
+ * \param[in] fils Le nombre de fils du pool.
+ * \param[in] commutation Le coût d'une commutation de contexte.
+ */
+void balayage(const string& nomFichier, int quantumMax, size_t fils, const CoutCommutation& commutation) {
+    const int temps = 0;
+    TableProcessus charge(ChargerFile(nomFichier));
+
+    vector<Reglage> grille;
+    for (int q = 1; q <= quantumMax; ++q) grille.push_back({PolitiqueBalayee::TOURNIQUET, q, 0});
+    for (int q = 1; q <= quantumMax; ++q) grille.push_back({PolitiqueBalayee::MULTINIVEAUX, q, 0});
+    for (int q = 1; q <= quantumMax; ++q) {
+        for (int r : {25, 50, 100, 200, 400}) grille.push_back({PolitiqueBalayee::MLFQ, q, r});
+    }
+
+    PoolTaches pool(fils);
+    cout << formaterBalayage(balayer(charge, grille, pool, temps, true, commutation));
+}
+
+/**
+ * \brief Tableau comparatif du tourniquet, du multiniveaux et de CFS sur plusieurs charges.
+ * \param[in] charges Les charges, avec le nom sous lequel les afficher.
+ * \param[in] quantum Le quantum du tourniquet et du multiniveaux.
+ * \param[in] latence La latence cible de CFS.
+ * \param[in] granularite La tranche minimale de CFS.
+ * \param[in] temps Le temps de décalage.
+ * \return Une ligne par charge et par politique : attente moyenne, p99 et maximale.
+ */
+string comparaison(const vector<pair<string, const File<Processus>*>>& charges, int quantum, int latence,
+                   int granularite, int temps) {
+    const vector<pair<string, function<void(TableProcessus&)>>> politiques = {
+        {"round_robin", [&](TableProcessus& t) { TP::round_robin(t, quantum, temps); }},
+        {"multiniveaux", [&](TableProcessus& t) { TP::multiniveaux(t, quantum, temps); }},
+        {"cfs", [&](TableProcessus& t) { TP::cfs(t, latence, granularite, temps); }},
+    };
+
+    ostringstream os;
+    os << left << setw(18) << "charge" << setw(14) << "politique" << right << setw(18) << "attente moyenne"
+       << setw(14) << "attente p99" << setw(14) << "attente max" << endl;
+    for (const auto& charge : charges) {
+        const TableProcessus source(*charge.second);
+        for (const auto& politique : politiques) {
+            TableProcessus table = source;
+            politique.second(table);
+            os << left << setw(18) << charge.first << setw(14) << politique.first << right << fixed
+               << setprecision(2) << setw(18) << table.tempsAttenteMoyen() << setw(14)
+               << table.attentePercentile(99) << setw(14) << table.attenteMax() << endl;
+        }
+    }
+    return os.str();
+}
+
+/**
+ * \brief Tableau de l'activité du processeur sous chaque politique sur une charge.
+ *
+ *        Le tourniquet et le multiniveaux sont évalués pour plusieurs quanta : plus
+ *        le quantum est petit, plus les commutations coûtent cher en débit. Sur une
+ *        charge qui fait des entrées-sorties, l'utilisation et le recouvrement
+ *        montrent combien chaque politique occupe le processeur pendant que les
+ *        processus bloqués attendent leurs périphériques.
+ *
+ * \param[in] nom Le nom de la charge, affiché en tête.
+ * \param[in] charge La charge.
+ * \param[in] commutation Le coût d'une commutation de contexte.
+ * \param[in] latence La latence cible de CFS.
+ * \param[in] granularite La tranche minimale de CFS.
+ * \param[in] temps Le temps de décalage.
+ * \return Une ligne par politique : commutations, surcoût total, attente moyenne, débit,
+ *         utilisation du processeur et part des entrées-sorties recouverte par du calcul.
+ */
+string activite(const string& nom, const File<Processus>& charge, const CoutCommutation& commutation, int latence,
+                int granularite, int temps) {
+    using Lancer = function<void(TableProcessus&, BilanProcesseur*)>;
+    vector<pair<string, Lancer>> politiques = {
+        {"fcfs", [&](TableProcessus& t, BilanProcesseur* b) { TP::fcfs(t, temps, commutation, b); }},
+        {"fjs", [&](TableProcessus& t, BilanProcesseur* b) { TP::fjs(t, temps, commutation, b); }},
+        {"srtf", [&](TableProcessus& t, BilanProcesseur* b) { TP::srtf(t, temps, commutation, b); }},
+        {"priorite", [&](TableProcessus& t, BilanProcesseur* b) { TP::priorite(t, temps, commutation, b); }},
+        {"edf", [&](TableProcessus& t, BilanProcesseur* b) { TP::edf(t, temps, commutation, b); }},
+        {"cfs", [&](TableProcessus& t, BilanProcesseur* b) {
+             TP::cfs(t, latence, granularite, temps, commutation, b);
+         }},
+    };
+    for (int q : {1, 2, 4, 8}) {
+        politiques.push_back({"round_robin q=" + to_string(q), [&, q](TableProcessus& t, BilanProcesseur* b) {
+                                  TP::round_robin(t, q, temps, commutation, b);
+                              }});
+        politiques.push_back({"multiniveaux q=" + to_string(q), [&, q](TableProcessus& t, BilanProcesseur* b) {
+                                  TP::multiniveaux(t, q, temps, commutation, b);
+                              }});
+        politiques.push_back({"mlfq q=" + to_string(q), [&, q](TableProcessus& t, BilanProcesseur* b) {
+                                  TP::mlfq(t, {q, 2 * q, 4 * q, 8 * q}, 50, temps, commutation, b);
+                              }});
+        politiques.push_back({"stride q=" + to_string(q), [&, q](TableProcessus& t, BilanProcesseur* b) {
+                                  TP::stride(t, q, temps, nullptr, commutation, b);
+                              }});
+    }
+
+    const TableProcessus source(charge);
+    ostringstream os;
+    os << "Charge : " << nom << ", commutation : " << commutation.base << " + rechauffement jusqu'a " << commutation.rechauffement
+       << " apres " << commutation.refroidissement << " d'absence" << endl;
+    os << left << setw(20) << "politique" << right << setw(14) << "commutations" << setw(10) << "surcout"
+       << setw(18) << "attente moyenne" << setw(10) << "debit" << setw(13) << "utilisation" << setw(14)
+       << "recouvrement" << endl;
+    for (const auto& politique : politiques) {
+        TableProcessus table = source;
+        BilanProcesseur bilan{};
+        politique.second(table, &bilan);
+        int derniere = table.taille() == 0 ? temps : *max_element(table.fins().begin(), table.fins().end());
+        double debit = derniere == temps ? 0 : static_cast<double>(table.taille()) / (derniere - temps);
+        os << left << setw(20) << politique.first << right << setw(14) << bilan.commutations << setw(10)
+           << bilan.surcout << fixed << setprecision(2) << setw(18) << table.tempsAttenteMoyen()
+           << setprecision(4) << setw(10) << debit << setprecision(2) << setw(13) << bilan.utilisation()
+           << setw(14) << bilan.recouvrement() << endl;
+    }
+    return os.str();
+}
+
 /**
  * \brief Point d'entrée du programme.
  *
  * Cette fonction charge plusieurs files de processus à partir de fichiers,
- * exécute différents algorithmes d'ordonnancement (FCFS, FJS, Round Robin, Priorité, Multiniveaux),
- * et affiche les résultats de chaque algorithme.
+ * exécute différents algorithmes d'ordonnancement (FCFS, FJS, SRTF, Round Robin, Priorité, Multiniveaux, MLFQ,
+ * Loterie, Stride, EDF), et affiche les résultats de chaque algorithme ; pour la loterie et le stride,
+ * les parts du processeur cible et obtenue par type de processus, et pour EDF le respect des échéances.
+ * Un tableau compare enfin CFS au tourniquet et au multiniveaux sur chaque fichier (voir comparaison()),
+ * et deux autres donnent, sur "Multiniveaux" et "EntreesSorties", ce que coûtent les commutations de
+ * contexte à chaque politique, l'utilisation du processeur et le recouvrement des entrées-sorties (voir
+ * activite()) ; l'option -c BASE [RECHAUFFEMENT REFROIDISSEMENT] fixe le coût des commutations, 1 + 2
+ * après 20 par défaut. Les résultats détaillés plus haut supposent des commutations gratuites.
  *
  * Les fichiers chargés sont :
  * - "FCFS_FJS_Round"
  * - "Multiniveaux"
  * - "Priorite"
+ * - "TempsReel" (avec échéances)
+ * - "EntreesSorties" (avec rafales de calcul et d'entrées-sorties)
+ *
+ * Les algorithmes sont indépendants : ils lisent les mêmes files d'entrée, partagées
+ * sans copie puisque personne ne les modifie, et s'exécutent en parallèle sur un
+ * PoolTaches. L'option -j N fixe le nombre de fils (par défaut, un par cœur) ;
+ * avec -j 1, les algorithmes s'exécutent l'un après l'autre dans le fil principal.
+ * Les résultats sont affichés dans l'ordre de la liste, quel que soit l'ordre
+ * dans lequel ils se terminent : la sortie ne dépend pas du nombre de fils.
  *
- * Les résultats de chaque algorithme sont affichés dans la console.
+ * Avec --balayage FICHIER [quantumMax], le programme évalue plutôt une grille de
+ * réglages sur FICHIER (voir balayage()) ; les commutations y sont gratuites sauf avec -c.
  *
  * \return Un entier représentant le statut de sortie du programme (0 pour le succès).
  */
-int main() {
-    int temps = 0;
-    int quantum = 4;
+int main(int argc, char* argv[]) {
+    if (argc > 2 && string(argv[1]) == "--balayage") {
+        int quantumMax = argc > 3 && argv[3][0] != '-' ? atoi(argv[3]) : 20;
+        balayage(argv[2], max(quantumMax, 1), lireFils(argc, argv), lireCommutation(argc, argv, CoutCommutation()));
+        return 0;
+    }
 
-    File<Processus> fileGen = ChargerFile("FCFS_FJS_Round");
-    File<Processus> file_multiniveaux = ChargerFile("Multiniveaux");
-    File<Processus> file_priorite = ChargerFile("Priorite");
+    const int temps = 0;
+    const int quantum = 4;
+    const int relevement = 50;
+    const unsigned graine = 2024;
+    const vector<int> quanta = {quantum, 2 * quantum, 4 * quantum, 8 * quantum};
+    const int latence = 6 * quantum;
+    const int granularite = quantum;
 
-    File<Processus> fcfs = TP::fcfs(fileGen, temps);
-    cout << fileGen.toString() << endl;
-    cout << fcfs.toString() << endl;
+    const File<Processus> fileGen = ChargerFile("FCFS_FJS_Round");
+    const File<Processus> file_multiniveaux = ChargerFile("Multiniveaux");
+    const File<Processus> file_priorite = ChargerFile("Priorite");
+    const File<Processus> file_temps_reel = ChargerFile("TempsReel");
+    const File<Processus> file_entrees_sorties = ChargerFile("EntreesSorties");
 
-    temps = 0;
-    File<Processus> fjs = TP::fjs(fileGen, temps);
-    cout << fjs.toString() << endl;
+    PartsParType partsLoterie;
+    PartsParType partsStride;
+    BilanEcheances bilanEdf;
 
-    temps = 0;
-    File<Processus> round = TP::round_robin(fileGen, quantum, temps);
-    cout << round.toString() << endl;
+    const vector<Simulation> simulations = {
+        {&fileGen, [&]() { return TP::fcfs(fileGen, temps); }, {}},
+        {nullptr, [&]() { return TP::fjs(fileGen, temps); }, {}},
+        {nullptr, [&]() { return TP::srtf(fileGen, temps); }, {}},
+        {nullptr, [&]() { return TP::round_robin(fileGen, quantum, temps); }, {}},
+        {&file_priorite, [&]() { return TP::priorite(file_priorite, temps); }, {}},
+        {&file_multiniveaux, [&]() { return TP::multiniveaux(file_multiniveaux, quantum, temps); }, {}},
+        {nullptr, [&]() { return TP::mlfq(file_multiniveaux, quanta, relevement, temps); }, {}},
+        {nullptr, [&]() { return TP::loterie(file_multiniveaux, quantum, graine, temps, &partsLoterie); },
+         [&]() { return partsLoterie.toString(); }},
+        {nullptr, [&]() { return TP::stride(file_multiniveaux, quantum, temps, &partsStride); },
+         [&]() { return partsStride.toString(); }},
+        {&file_temps_reel, [&]() { return TP::edf(file_temps_reel, temps, &bilanEdf); },
+         [&]() { return bilanEdf.toString(); }},
+        {&file_entrees_sorties, [&]() { return TP::round_robin(file_entrees_sorties, quantum, temps); }, {}},
+    };
 
-    temps = 0;
-    File<Processus> priorite = TP::priorite(file_priorite, temps);
-    cout << file_priorite.toString() << endl;
-    cout << priorite.toString() << endl;
+    size_t fils = lireFils(argc, argv);
+    vector<File<Processus>> resultats;
+    resultats.reserve(simulations.size());
+    if (fils == 1) {
+        for (const Simulation& simulation : simulations) resultats.push_back(simulation.lancer());
+    } else {
+        PoolTaches pool(min(fils, simulations.size()));
+        vector<future<File<Processus>>> enCours;
+        enCours.reserve(simulations.size());
+        for (const Simulation& simulation : simulations) enCours.push_back(pool.soumettre(simulation.lancer));
+        for (future<File<Processus>>& resultat : enCours) resultats.push_back(resultat.get());
+    }
 
-    temps = 0;
-    File<Processus> multiniveaux = TP::multiniveaux(file_multiniveaux, quantum, temps);
-    cout << file_multiniveaux.toString() << endl;
-    cout << multiniveaux.toString() << endl;
+    for (size_t i = 0; i < simulations.size(); ++i) {
+        if (simulations[i].entree != nullptr) cout << simulations[i].entree->toString() << endl;
+        cout << resultats[i].toString() << endl;
+        if (simulations[i].bilan) cout << simulations[i].bilan() << endl;
+    }
+
+    cout << comparaison({{"FCFS_FJS_Round", &fileGen}, {"Priorite", &file_priorite},
+                         {"Multiniveaux", &file_multiniveaux}, {"TempsReel", &file_temps_reel},
+                         {"EntreesSorties", &file_entrees_sorties}},
+                        quantum, latence, granularite, temps) << endl;
+    const CoutCommutation commutation = lireCommutation(argc, argv, CoutCommutation{1, 2, 20});
+    cout << activite("Multiniveaux", file_multiniveaux, commutation, latence, granularite, temps) << endl;
+    cout << activite("EntreesSorties", file_entrees_sorties, commutation, latence, granularite, temps) << endl;
 
     cout << "Fin du programme" << endl;
     return 0;
-}
\ No newline at end of file
+}
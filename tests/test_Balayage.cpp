@@ -0,0 +1,118 @@
+//
+// Created by Vincent on 10/1/2024.
+//
+
+#include "gtest/gtest.h"
+#include "Balayage.h"
+#include "Ordonnanceur.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace {
+  TableProcessus charge(int n) {
+    TableProcessus table;
+    const TypeProcessus types[] = {TypeProcessus::SYSTEME, TypeProcessus::INTERACTIF, TypeProcessus::BATCH,
+                                   TypeProcessus::UTILISATEUR};
+    int arrivee = 0;
+    for (int i = 0; i < n; ++i) {
+      arrivee += (i * 7) % 5;
+      table.ajouter("b" + std::to_string(i), arrivee, (i * 13) % 17 + 1, i % 7, types[(i * 3) % 4]);
+    }
+    return table;
+  }
+
+  std::vector<Reglage> grille() {
+    std::vector<Reglage> reglages;
+    for (int q = 1; q <= 12; ++q) reglages.push_back({PolitiqueBalayee::TOURNIQUET, q, 0});
+    for (int q = 1; q <= 6; ++q) reglages.push_back({PolitiqueBalayee::MULTINIVEAUX, q, 0});
+    for (int q = 1; q <= 4; ++q) {
+      for (int r : {20, 200}) reglages.push_back({PolitiqueBalayee::MLFQ, q, r});
+    }
+    return reglages;
+  }
+}
+
+TEST(Balayage, domine_exige_un_critere_strict) {
+  MesureReglage a{{PolitiqueBalayee::TOURNIQUET, 1, 0}, true, false, 10, 10, 100, 5, 50, BilanProcesseur{0, 0, 0, 0, 0, 0}};
+  MesureReglage b = a;
+  EXPECT_FALSE(domine(a, b));
+  b.attenteP99 = 6;
+  EXPECT_TRUE(domine(a, b));
+  EXPECT_FALSE(domine(b, a));
+  a.sommeAttente = 101;
+  EXPECT_FALSE(domine(a, b));
+}
+
+TEST(Balayage, mesures_egales_a_la_simulation) {
+  const TableProcessus source = charge(3000);
+  PoolTaches pool(2);
+  std::vector<Reglage> reglages = {{PolitiqueBalayee::TOURNIQUET, 3, 0},
+                                   {PolitiqueBalayee::MLFQ, 2, 50}};
+  std::vector<MesureReglage> mesures = balayer(source, reglages, pool, 0, false);
+  ASSERT_EQ(2, mesures.size());
+
+  TableProcessus rr = source;
+  TP::round_robin(rr, 3, 0);
+  TableProcessus mlfq = source;
+  TP::mlfq(mlfq, {2, 4, 8, 16}, 50, 0);
+  const TableProcessus* attendus[] = {&rr, &mlfq};
+  for (size_t k = 0; k < 2; ++k) {
+    EXPECT_TRUE(mesures[k].complet);
+    EXPECT_EQ(source.taille(), mesures[k].termines);
+    EXPECT_DOUBLE_EQ(attendus[k]->tempsAttenteMoyen(), mesures[k].attenteMoyenne());
+    EXPECT_EQ(attendus[k]->attentePercentile(99), mesures[k].attenteP99);
+    EXPECT_EQ(*std::max_element(attendus[k]->fins().begin(), attendus[k]->fins().end()), mesures[k].duree);
+  }
+}
+
+TEST(Balayage, elagage_garde_le_front_de_pareto) {
+  const TableProcessus source = charge(20000);
+  PoolTaches pool(4);
+  std::vector<MesureReglage> complets = balayer(source, grille(), pool, 0, false);
+  std::vector<MesureReglage> elagues = balayer(source, grille(), pool, 0, true);
+  ASSERT_EQ(complets.size(), elagues.size());
+
+  for (size_t k = 0; k < complets.size(); ++k) {
+    EXPECT_TRUE(complets[k].complet);
+    EXPECT_EQ(complets[k].pareto, elagues[k].pareto) << complets[k].reglage.nom();
+    if (elagues[k].complet) {
+      EXPECT_EQ(complets[k].sommeAttente, elagues[k].sommeAttente);
+      EXPECT_EQ(complets[k].attenteP99, elagues[k].attenteP99);
+    } else {
+      EXPECT_FALSE(complets[k].pareto);
+      EXPECT_LE(elagues[k].sommeAttente, complets[k].sommeAttente);
+      EXPECT_LE(elagues[k].attenteP99, complets[k].attenteP99);
+      EXPECT_LE(elagues[k].duree, complets[k].duree);
+    }
+  }
+}
+
+TEST(Balayage, tableau_une_ligne_par_reglage) {
+  const TableProcessus source = charge(100);
+  PoolTaches pool(2);
+  std::vector<MesureReglage> mesures = balayer(source, grille(), pool, 0);
+  std::string tableau = formaterBalayage(mesures);
+  EXPECT_EQ(grille().size() + 1, static_cast<size_t>(std::count(tableau.begin(), tableau.end(), '\n')));
+  EXPECT_NE(std::string::npos, tableau.find("mlfq q=4 r=200"));
+  EXPECT_TRUE(std::any_of(mesures.begin(), mesures.end(), [](const MesureReglage& m) { return m.pareto; }));
+}
+
+TEST(Balayage, commutations_payees_par_les_petits_quanta) {
+  const TableProcessus source = charge(2000);
+  PoolTaches pool(2);
+  std::vector<Reglage> reglages = {{PolitiqueBalayee::TOURNIQUET, 1, 0}, {PolitiqueBalayee::TOURNIQUET, 16, 0}};
+  std::vector<MesureReglage> gratuites = balayer(source, reglages, pool, 0, false);
+  std::vector<MesureReglage> payees = balayer(source, reglages, pool, 0, false, CoutCommutation{1, 0, 0});
+  EXPECT_EQ(0, gratuites[0].processeur.surcout);
+  EXPECT_EQ(payees[0].processeur.commutations, payees[0].processeur.surcout);
+  EXPECT_GT(payees[0].processeur.commutations, 2 * payees[1].processeur.commutations);
+  EXPECT_LT(payees[0].debit(), payees[1].debit());
+  EXPECT_LT(payees[1].debit(), gratuites[1].debit());
+
+  TableProcessus table = source;
+  BilanProcesseur bilan{};
+  TP::round_robin(table, 1, 0, CoutCommutation{1, 0, 0}, &bilan);
+  EXPECT_EQ(bilan.commutations, payees[0].processeur.commutations);
+  EXPECT_DOUBLE_EQ(table.tempsAttenteMoyen(), payees[0].attenteMoyenne());
+}
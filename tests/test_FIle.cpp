@@ -4,6 +4,12 @@
 
 #include "gtest/gtest.h"
 #include "File.h"
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <thread>
 
 class FileTest : public ::testing::Test {
   protected:
@@ -106,4 +112,242 @@ TEST_F(FileTest, F5_supprimer_tous) {
 
 TEST_F(FileTest, F5_get1) {
   EXPECT_EQ(F5.getValeur(0), 1 );
-}
\ No newline at end of file
+}
+
+TEST(FileContigue, insertion_et_acces_indexe) {
+  File<int, StockageContigu> l ;
+  for (int i = 0; i < 100; ++i) l.insererDernier(i);
+  EXPECT_EQ(100, l.taille());
+  EXPECT_EQ(0, l.getValeur(0));
+  EXPECT_EQ(57, l.getValeur(57));
+  EXPECT_EQ(99, l.getValeur(99));
+}
+
+TEST(FileContigue, tampon_circulaire_apres_retraits) {
+  File<int, StockageContigu> l ;
+  for (int i = 0; i < 6; ++i) l.insererDernier(i);
+  for (int i = 0; i < 5; ++i) l.supprimerPremier();
+  for (int i = 6; i < 20; ++i) l.insererDernier(i);
+  EXPECT_EQ(15, l.taille());
+  for (size_t i = 0; i < l.taille(); ++i) EXPECT_EQ(static_cast<int>(i) + 5, l.getValeur(i));
+}
+
+TEST(FileContigue, supprimer_et_inserer_au_milieu) {
+  File<int, StockageContigu> l ;
+  for (int i = 1; i <= 5; ++i) l.insererDernier(i);
+  l.supprimer(2);
+  l.supprimer(4);
+  int val = 9;
+  l.inserer(1, val);
+  EXPECT_EQ(4, l.taille());
+  EXPECT_EQ(1, l.getValeur(0));
+  EXPECT_EQ(9, l.getValeur(1));
+  EXPECT_EQ(3, l.getValeur(2));
+  EXPECT_EQ(5, l.getValeur(3));
+}
+
+TEST_F(FileTest, F5_copie_vers_contigue) {
+  File<int, StockageContigu> c(F5) ;
+  EXPECT_EQ(c.toString(), F5.toString());
+  EXPECT_THROW(c.getValeur(5), std::out_of_range);
+}
+
+TEST(FileAllocateur, allocateur_standard_meme_comportement) {
+  File<int, StockageChaine, AllocateurStandard> l ;
+  for (int i = 1; i <= 5; ++i) l.insererDernier(i);
+  l.supprimer(3);
+  l.supprimerPremier();
+  EXPECT_EQ(3, l.taille());
+  EXPECT_EQ(2, l.getValeur(0));
+  EXPECT_EQ(5, l.getValeur(2));
+}
+
+TEST(FileAllocateur, pool_recycle_les_noeuds) {
+  File<std::string> l ;
+  for (int tour = 0; tour < 1000; ++tour) {
+    for (int i = 0; i < 50; ++i) l.insererDernier(std::to_string(i));
+    while (!l.estVide()) l.supprimerPremier();
+  }
+  l.insererDernier("fin");
+  EXPECT_EQ("fin", l.getValeur(0));
+}
+
+TEST(FileAllocateur, pool_rend_les_noeuds_au_fil_qui_les_a_pris) {
+  // Un fil produit des files que le fil principal détruit : sans retour des blocs
+  // à leur propriétaire, le producteur découperait une dalle neuve à chaque tour.
+  const int TOURS = 50;
+  const int ELEMENTS = 2000;
+  std::mutex verrou;
+  std::condition_variable signal;
+  File<long> transit;
+  bool plein = false;
+  std::set<const long*> adresses;
+
+  std::thread producteur([&]() {
+    for (int tour = 0; tour < TOURS; ++tour) {
+      File<long> f;
+      for (int i = 0; i < ELEMENTS; ++i) f.insererDernier(i);
+      for (const long& v : f) adresses.insert(&v);
+      std::unique_lock<std::mutex> garde(verrou);
+      signal.wait(garde, [&]() { return !plein; });
+      transit = std::move(f);
+      plein = true;
+      signal.notify_all();
+    }
+  });
+  for (int tour = 0; tour < TOURS; ++tour) {
+    File<long> recue;
+    {
+      std::unique_lock<std::mutex> garde(verrou);
+      signal.wait(garde, [&]() { return plein; });
+      recue = std::move(transit);
+      plein = false;
+      signal.notify_all();
+    }
+    EXPECT_EQ(static_cast<size_t>(ELEMENTS), recue.taille());
+  }
+  producteur.join();
+  EXPECT_LT(adresses.size(), static_cast<size_t>(5 * ELEMENTS));
+}
+
+TEST_F(FileTest, F5_deplacement_vide_la_source) {
+  File<int> d(std::move(F5)) ;
+  EXPECT_TRUE(F5.estVide());
+  EXPECT_EQ(5, d.taille());
+  F1 = std::move(d);
+  EXPECT_EQ(5, F1.taille());
+  EXPECT_EQ(5, F1.getValeur(4));
+}
+
+TEST_F(FileTest, F5_affectation_par_copie) {
+  F1 = F5;
+  F5.supprimerPremier();
+  EXPECT_EQ(5, F1.taille());
+  EXPECT_EQ(1, F1.getValeur(0));
+}
+
+TEST(File, emplace_et_acces_par_reference) {
+  File<std::string> l ;
+  l.emplaceDernier(3, 'a');
+  l.insererDernier(std::string("b"));
+  l.getValeur(0) += "z";
+  EXPECT_EQ("aaaz", l.getValeur(0));
+  EXPECT_EQ("b", l.getValeur(1));
+  EXPECT_THROW(l.getValeur(2), std::out_of_range);
+}
+
+TEST(FileContigue, deplacement_et_emplace) {
+  File<std::string, StockageContigu> l ;
+  for (int i = 0; i < 20; ++i) l.emplaceDernier(std::to_string(i));
+  File<std::string, StockageContigu> d(std::move(l)) ;
+  EXPECT_TRUE(l.estVide());
+  d.getValeur(19) = "dernier";
+  l = d;
+  EXPECT_EQ(20, l.taille());
+  EXPECT_EQ("dernier", l.getValeur(19));
+}
+
+TEST_F(FileTest, F5_parcours_par_iterateurs) {
+  int somme = 0;
+  for (int v : F5) somme += v;
+  EXPECT_EQ(15, somme);
+  EXPECT_EQ(F0.begin(), F0.end());
+  for (auto it = F5.begin(); it != F5.end(); ++it) *it *= 2;
+  const File<int>& cf = F5;
+  EXPECT_EQ(30, std::accumulate(cf.cbegin(), cf.cend(), 0));
+  EXPECT_EQ(10, *std::max_element(cf.begin(), cf.end()));
+}
+
+TEST(FileContigue, parcours_par_iterateurs) {
+  File<int, StockageContigu> l ;
+  for (int i = 0; i < 12; ++i) l.insererDernier(i);
+  l.supprimerPremier();
+  l.supprimerPremier();
+  File<int, StockageContigu>::const_iterator it = l.begin();
+  EXPECT_EQ(2, *it);
+  EXPECT_EQ(10, std::distance(l.begin(), l.end()));
+  EXPECT_EQ(11, *std::max_element(l.begin(), l.end()));
+}
+
+TEST_F(FileTest, F5_supprimer_par_iterateur) {
+  auto it = std::find(F5.begin(), F5.end(), 3);
+  auto garde = std::find(F5.begin(), F5.end(), 4);
+  it = F5.supprimer(it);
+  EXPECT_EQ(garde, it);
+  EXPECT_EQ(4, *garde);
+  it = F5.supprimer(std::find(F5.begin(), F5.end(), 5));
+  EXPECT_EQ(F5.end(), it);
+  F5.insererDernier(6);
+  EXPECT_EQ(F5.toString(), "1\n2\n4\n6\nfin chargement\n");
+}
+
+TEST_F(FileTest, F5_inserer_en_fin) {
+  int val = 6;
+  F5.inserer(5, val);
+  EXPECT_EQ(6, F5.getValeur(5));
+  F5.supprimerPremier();
+  EXPECT_EQ(2, F5.getValeur(0));
+}
+
+TEST(FileContigue, supprimer_par_iterateur) {
+  File<int, StockageContigu> l ;
+  for (int i = 0; i < 10; ++i) l.insererDernier(i);
+  auto it = l.supprimer(std::find(l.begin(), l.end(), 2));
+  EXPECT_EQ(3, *it);
+  it = l.supprimer(std::find(l.begin(), l.end(), 8));
+  EXPECT_EQ(9, *it);
+  EXPECT_EQ(8, l.taille());
+}
+
+TEST_F(FileTest, F5_concatener_F1) {
+  auto garde = F1.begin();
+  F5.concatener(std::move(F1));
+  EXPECT_TRUE(F1.estVide());
+  EXPECT_EQ(6, F5.taille());
+  EXPECT_EQ(1, F5.getDernier());
+  EXPECT_EQ(1, *garde);
+  F5.insererDernier(7);
+  EXPECT_EQ(F5.toString(), "1\n2\n3\n4\n5\n1\n7\nfin chargement\n");
+  EXPECT_EQ(7, *++garde);
+  EXPECT_TRUE(++garde == F5.end());
+}
+
+TEST_F(FileTest, deplacement_garde_les_iterateurs) {
+  auto garde = F5.begin();
+  File<int> reprise(std::move(F5));
+  EXPECT_EQ(5, std::distance(garde, reprise.end()));
+  File<int> affectee ;
+  affectee.insererDernier(9);
+  affectee = std::move(reprise);
+  EXPECT_TRUE(reprise.estVide());
+  EXPECT_EQ(5, std::distance(garde, affectee.end()));
+  EXPECT_EQ(affectee.toString(), "1\n2\n3\n4\n5\nfin chargement\n");
+}
+
+TEST_F(FileTest, F5_splice_au_milieu_et_en_tete) {
+  File<int> milieu ;
+  int valeurs[] = {8, 9};
+  milieu.insererPlage(valeurs, valeurs + 2);
+  F5.splice(std::find(F5.cbegin(), F5.cend(), 3), milieu);
+  F5.splice(F5.cbegin(), F1);
+  EXPECT_TRUE(milieu.estVide());
+  EXPECT_EQ(F5.toString(), "1\n1\n2\n8\n9\n3\n4\n5\nfin chargement\n");
+  F0.splice(F0.cend(), F5);
+  EXPECT_EQ(8, F0.taille());
+  EXPECT_EQ(5, F0.getDernier());
+}
+
+TEST(FileContigue, splice_et_concatener) {
+  File<int, StockageContigu> a ;
+  File<int, StockageContigu> b ;
+  int valeurs[] = {1, 2, 5};
+  a.insererPlage(valeurs, valeurs + 3);
+  b.insererDernier(3);
+  b.insererDernier(4);
+  a.splice(std::find(a.cbegin(), a.cend(), 5), b);
+  EXPECT_TRUE(b.estVide());
+  b.insererDernier(6);
+  a.concatener(std::move(b));
+  for (int i = 0; i < 6; ++i) EXPECT_EQ(i + 1, a.getValeur(i));
+  EXPECT_EQ(6, a.getDernier());
+}
@@ -0,0 +1,59 @@
+//
+// Created by Vincent on 10/1/2024.
+//
+
+#include "gtest/gtest.h"
+#include "FileConcurrente.h"
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(FileConcurrente, constructeur_vide) {
+  FileConcurrente<int> f ;
+  EXPECT_TRUE(f.estVide());
+  EXPECT_EQ(0, f.taille());
+  int sortie = -1;
+  EXPECT_FALSE(f.extrairePremier(sortie));
+}
+
+TEST(FileConcurrente, ordre_fifo_un_seul_fil) {
+  FileConcurrente<std::string> f ;
+  f.insererDernier("a");
+  f.emplaceDernier(2, 'b');
+  f.insererDernier(std::string("c"));
+  EXPECT_EQ(3, f.taille());
+  EXPECT_EQ("a", f.premier());
+  f.supprimerPremier();
+  std::string sortie;
+  EXPECT_TRUE(f.extrairePremier(sortie));
+  EXPECT_EQ("bb", sortie);
+  EXPECT_EQ("c", f.premier());
+  EXPECT_EQ(1, f.taille());
+}
+
+TEST(FileConcurrente, producteurs_multiples) {
+  const int producteurs = 8;
+  const int parProducteur = 20000;
+  FileConcurrente<std::pair<int, int>> f ;
+
+  std::vector<std::thread> fils;
+  for (int p = 0; p < producteurs; ++p) {
+    fils.emplace_back([&f, p, parProducteur]() {
+      for (int i = 0; i < parProducteur; ++i) f.insererDernier(std::make_pair(p, i));
+    });
+  }
+
+  std::vector<int> prochain(producteurs, 0);
+  int recus = 0;
+  std::pair<int, int> v;
+  while (recus < producteurs * parProducteur) {
+    if (f.extrairePremier(v)) {
+      ASSERT_EQ(prochain[v.first], v.second);
+      ++prochain[v.first];
+      ++recus;
+    }
+  }
+  for (auto& fil : fils) fil.join();
+  EXPECT_TRUE(f.estVide());
+  EXPECT_EQ(0, f.taille());
+}
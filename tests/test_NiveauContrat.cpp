@@ -0,0 +1,53 @@
+//
+// Created by Vincent on 10/1/2024.
+//
+// Compilé une fois par niveau de NIVEAU_CONTRAT (voir tests/CMakeLists.txt).
+//
+
+#include "gtest/gtest.h"
+#include "ContratException.h"
+
+namespace {
+  // f n'est pas lu aux niveaux où la macro est vide.
+  void precondition(bool f) { static_cast<void>(f); PRECONDITION(f); }
+  void postcondition(bool f) { static_cast<void>(f); POSTCONDITION(f); }
+  void assertion(bool f) { static_cast<void>(f); ASSERTION(f); }
+  void invariant(bool f) { static_cast<void>(f); INVARIANT(f); }
+  void audit(bool f) { static_cast<void>(f); AUDIT(f); }
+}
+
+TEST(NiveauContrat, conditions_respectees_acceptees) {
+  EXPECT_NO_THROW(precondition(true));
+  EXPECT_NO_THROW(postcondition(true));
+  EXPECT_NO_THROW(assertion(true));
+  EXPECT_NO_THROW(invariant(true));
+  EXPECT_NO_THROW(audit(true));
+}
+
+TEST(NiveauContrat, precondition_active_des_le_niveau_1) {
+#if NIVEAU_CONTRAT >= 1
+  EXPECT_THROW(precondition(false), PreconditionException);
+#else
+  EXPECT_NO_THROW(precondition(false));
+#endif
+}
+
+TEST(NiveauContrat, postcondition_assertion_invariant_actives_des_le_niveau_2) {
+#if NIVEAU_CONTRAT >= 2
+  EXPECT_THROW(postcondition(false), PostconditionException);
+  EXPECT_THROW(assertion(false), AssertionException);
+  EXPECT_THROW(invariant(false), InvariantException);
+#else
+  EXPECT_NO_THROW(postcondition(false));
+  EXPECT_NO_THROW(assertion(false));
+  EXPECT_NO_THROW(invariant(false));
+#endif
+}
+
+TEST(NiveauContrat, audit_actif_au_niveau_3) {
+#if NIVEAU_CONTRAT >= 3
+  EXPECT_THROW(audit(false), AssertionException);
+#else
+  EXPECT_NO_THROW(audit(false));
+#endif
+}
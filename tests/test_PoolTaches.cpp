@@ -0,0 +1,61 @@
+//
+// Created by Vincent on 10/1/2024.
+//
+
+#include "gtest/gtest.h"
+#include "PoolTaches.h"
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+TEST(PoolTaches, taille_au_moins_un_fil) {
+  PoolTaches pool(0);
+  EXPECT_EQ(1, pool.taille());
+  PoolTaches quatre(4);
+  EXPECT_EQ(4, quatre.taille());
+}
+
+TEST(PoolTaches, resultats_dans_l_ordre_de_soumission) {
+  PoolTaches pool(4);
+  std::vector<std::future<int>> resultats;
+  for (int i = 0; i < 100; ++i) {
+    resultats.push_back(pool.soumettre([i]() { return i * i; }));
+  }
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(i * i, resultats[i].get());
+  }
+}
+
+TEST(PoolTaches, exception_transmise_par_le_future) {
+  PoolTaches pool(2);
+  std::future<int> echec = pool.soumettre([]() -> int { throw std::runtime_error("echec"); });
+  std::future<int> succes = pool.soumettre([]() { return 7; });
+  EXPECT_THROW(echec.get(), std::runtime_error);
+  EXPECT_EQ(7, succes.get());
+}
+
+TEST(PoolTaches, destructeur_termine_les_taches_soumises) {
+  std::atomic<int> executees(0);
+  {
+    PoolTaches pool(3);
+    for (int i = 0; i < 1000; ++i) {
+      pool.soumettre([&executees]() { ++executees; });
+    }
+  }
+  EXPECT_EQ(1000, executees.load());
+}
+
+TEST(PoolTaches, tache_qui_lit_une_donnee_partagee) {
+  const std::vector<int> donnees = {1, 2, 3, 4, 5};
+  PoolTaches pool(4);
+  std::vector<std::future<int>> sommes;
+  for (int k = 0; k < 8; ++k) {
+    sommes.push_back(pool.soumettre([&donnees, k]() {
+      int somme = 0;
+      for (int v : donnees) somme += v * k;
+      return somme;
+    }));
+  }
+  for (int k = 0; k < 8; ++k) EXPECT_EQ(15 * k, sommes[k].get());
+}
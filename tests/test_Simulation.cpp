@@ -0,0 +1,590 @@
+//
+// Created by Vincent on 10/1/2024.
+//
+
+#include "gtest/gtest.h"
+#include "Ordonnanceur.h"
+#include "Politiques.h"
+#include "Simulation.h"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace {
+  File<Processus> charger(const std::vector<Processus>& processus) {
+    File<Processus> f;
+    for (const Processus& p : processus) f.insererDernier(p);
+    return f;
+  }
+}
+
+TEST(Simulation, fcfs_inactivite_entre_arrivees) {
+  File<Processus> f = charger({Processus("p1", 0, 2, 1, TypeProcessus::BATCH),
+                               Processus("p2", 10, 3, 1, TypeProcessus::BATCH)});
+  File<Processus> r = TP::fcfs(f, 0);
+  ASSERT_EQ(2, r.taille());
+  EXPECT_EQ(0, r.getValeur(1).getAttente());
+  EXPECT_EQ(13, r.getValeur(1).getFin());
+  EXPECT_FLOAT_EQ(0, r.getTempsMoy());
+}
+
+TEST(Simulation, fjs_choisit_parmi_les_arrives) {
+  File<Processus> f = charger({Processus("p1", 0, 8, 1, TypeProcessus::BATCH),
+                               Processus("p2", 1, 6, 1, TypeProcessus::BATCH),
+                               Processus("p3", 2, 2, 1, TypeProcessus::BATCH)});
+  File<Processus> r = TP::fjs(f, 0);
+  ASSERT_EQ(3, r.taille());
+  EXPECT_EQ("p1", r.getValeur(0).getId());
+  EXPECT_EQ("p3", r.getValeur(1).getId());
+  EXPECT_EQ("p2", r.getValeur(2).getId());
+  EXPECT_EQ(9, r.getValeur(2).getAttente());
+}
+
+TEST(Simulation, round_robin_arrivees_decalees) {
+  File<Processus> f = charger({Processus("p1", 0, 5, 1, TypeProcessus::BATCH),
+                               Processus("p2", 1, 3, 1, TypeProcessus::BATCH),
+                               Processus("p3", 10, 2, 1, TypeProcessus::BATCH)});
+  File<Processus> r = TP::round_robin(f, 2, 0);
+  std::vector<std::string> ordre;
+  std::vector<int> fins;
+  for (const Processus& p : r) {
+    ordre.push_back(p.getId());
+    fins.push_back(p.getFin());
+  }
+  EXPECT_EQ((std::vector<std::string>{"p2", "p1", "p3"}), ordre);
+  EXPECT_EQ((std::vector<int>{7, 8, 12}), fins);
+  EXPECT_FLOAT_EQ(2, r.getTempsMoy());
+}
+
+TEST(Simulation, round_robin_grand_quantum_egale_fcfs) {
+  TableProcessus fcfs;
+  for (int i = 0; i < 1000; ++i) {
+    fcfs.ajouter("rr" + std::to_string(i), (i * 7) % 50 + i, i % 13 + 1, 0, TypeProcessus::BATCH);
+  }
+  TableProcessus rr = fcfs;
+  EXPECT_EQ(TP::fcfs(fcfs, 0), TP::round_robin(rr, 13, 0));
+  EXPECT_EQ(fcfs.attentes(), rr.attentes());
+  EXPECT_EQ(fcfs.fins(), rr.fins());
+}
+
+TEST(Simulation, srtf_preempte_a_l_arrivee) {
+  File<Processus> f = charger({Processus("p1", 0, 8, 1, TypeProcessus::BATCH),
+                               Processus("p2", 1, 4, 1, TypeProcessus::BATCH),
+                               Processus("p3", 2, 9, 1, TypeProcessus::BATCH),
+                               Processus("p4", 3, 5, 1, TypeProcessus::BATCH)});
+  File<Processus> r = TP::srtf(f, 0);
+  std::vector<std::string> ordre;
+  for (const Processus& p : r) ordre.push_back(p.getId());
+  EXPECT_EQ((std::vector<std::string>{"p2", "p4", "p1", "p3"}), ordre);
+  EXPECT_EQ(17, r.getValeur(2).getFin());
+  EXPECT_FLOAT_EQ(6.5, r.getTempsMoy());
+}
+
+TEST(Simulation, srtf_egalite_garde_le_courant) {
+  File<Processus> f = charger({Processus("p1", 0, 4, 1, TypeProcessus::BATCH),
+                               Processus("p2", 1, 3, 1, TypeProcessus::BATCH)});
+  File<Processus> r = TP::srtf(f, 0);
+  ASSERT_EQ(2, r.taille());
+  EXPECT_EQ("p1", r.getValeur(0).getId());
+  EXPECT_EQ(4, r.getValeur(0).getFin());
+}
+
+TEST(Simulation, srtf_borne_inferieure) {
+  TableProcessus fjs(charger({Processus("p1", 0, 24, 1, TypeProcessus::SYSTEME),
+                              Processus("p2", 2, 3, 1, TypeProcessus::SYSTEME),
+                              Processus("p3", 4, 3, 1, TypeProcessus::SYSTEME)}));
+  TableProcessus srtf = fjs;
+  TP::fjs(fjs, 0);
+  TP::srtf(srtf, 0);
+  EXPECT_LT(srtf.tempsAttenteMoyen(), fjs.tempsAttenteMoyen());
+}
+
+TEST(Simulation, round_robin_fichier_exemple) {
+  File<Processus> f = charger({Processus("p1", 0, 24, 1, TypeProcessus::SYSTEME),
+                               Processus("p2", 0, 3, 1, TypeProcessus::SYSTEME),
+                               Processus("p3", 0, 3, 1, TypeProcessus::SYSTEME),
+                               Processus("p4", 30, 2, 1, TypeProcessus::SYSTEME)});
+  File<Processus> r = TP::round_robin(f, 4, 0);
+  std::vector<int> attentes;
+  for (const Processus& p : r) attentes.push_back(p.getAttente());
+  EXPECT_EQ((std::vector<int>{4, 7, 6, 0}), attentes);
+  EXPECT_EQ("p1", r.getValeur(2).getId());
+  EXPECT_FLOAT_EQ(4.25, r.getTempsMoy());
+}
+
+TEST(Simulation, priorite_preemptive_sans_vieillissement) {
+  File<Processus> f = charger({Processus("p1", 0, 10, 1, TypeProcessus::BATCH),
+                               Processus("p2", 2, 3, 5, TypeProcessus::BATCH)});
+  File<Processus> r = TP::priorite_preemptive(f, std::numeric_limits<int>::max(), 0);
+  ASSERT_EQ(2, r.taille());
+  EXPECT_EQ("p2", r.getValeur(0).getId());
+  EXPECT_EQ(5, r.getValeur(0).getFin());
+  EXPECT_EQ(13, r.getValeur(1).getFin());
+}
+
+TEST(Simulation, priorite_preemptive_vieillissement_borne_l_attente) {
+  TableProcessus sans;
+  sans.ajouter("bas", 0, 2, 0, TypeProcessus::BATCH);
+  for (int k = 0; k < 20; ++k) sans.ajouter("haut" + std::to_string(k), 2 * k, 2, 5, TypeProcessus::BATCH);
+  TableProcessus avec = sans;
+  TP::priorite_preemptive(sans, std::numeric_limits<int>::max(), 0);
+  TP::priorite_preemptive(avec, 4, 0);
+  EXPECT_EQ(40, sans.attentes()[0]);
+  // Après 5 périodes d'attente, bas égale la priorité 5 et passe avant haut10, arrivé plus tard.
+  EXPECT_EQ(20, avec.attentes()[0]);
+  EXPECT_LT(avec.attenteMax(), sans.attenteMax());
+}
+
+TEST(Simulation, percentiles_attente) {
+  TableProcessus table;
+  for (int i = 0; i < 100; ++i) table.ajouter("q" + std::to_string(i), 0, 1, 0, TypeProcessus::BATCH);
+  TP::fcfs(table, 0);
+  EXPECT_EQ(99, table.attenteMax());
+  EXPECT_EQ(98, table.attentePercentile(99));
+  EXPECT_EQ(49, table.attentePercentile(50));
+  EXPECT_EQ(0, table.attentePercentile(0));
+  EXPECT_EQ(0, TableProcessus().attentePercentile(99));
+}
+
+TEST(Simulation, multiniveaux_niveaux_vides) {
+  File<Processus> f = charger({Processus("p1", 0, 5, 1, TypeProcessus::BATCH),
+                               Processus("p2", 0, 4, 1, TypeProcessus::UTILISATEUR)});
+  File<Processus> r = TP::multiniveaux(f, 4, 0);
+  ASSERT_EQ(2, r.taille());
+  EXPECT_EQ("p1", r.getValeur(0).getId());
+  EXPECT_EQ(5, r.getValeur(1).getAttente());
+}
+
+TEST(Simulation, multiniveaux_arrivee_systeme_preempte) {
+  File<Processus> f = charger({Processus("p1", 0, 10, 1, TypeProcessus::BATCH),
+                               Processus("p2", 3, 2, 1, TypeProcessus::SYSTEME)});
+  File<Processus> r = TP::multiniveaux(f, 4, 0);
+  ASSERT_EQ(2, r.taille());
+  EXPECT_EQ("p2", r.getValeur(0).getId());
+  EXPECT_EQ(5, r.getValeur(0).getFin());
+  EXPECT_EQ(12, r.getValeur(1).getFin());
+}
+
+TEST(Simulation, mlfq_descente_et_preemption) {
+  TableProcessus table;
+  table.ajouter("a", 0, 10, 1, TypeProcessus::SYSTEME);
+  table.ajouter("b", 3, 2, 1, TypeProcessus::SYSTEME);
+  PolitiqueMlfq politique(table, {2, 4}, std::numeric_limits<int>::max());
+  std::vector<uint32_t> ordre = simuler(table, politique, 0);
+  EXPECT_EQ((std::vector<uint32_t>{1, 0}), ordre);
+  EXPECT_EQ(5, table.fins()[1]);
+  EXPECT_EQ(12, table.fins()[0]);
+  EXPECT_EQ(1, politique.niveau(0));
+  EXPECT_EQ(0, politique.niveau(1));
+}
+
+TEST(Simulation, mlfq_placement_par_type) {
+  File<Processus> f = charger({Processus("u", 0, 3, 1, TypeProcessus::UTILISATEUR),
+                               Processus("i", 0, 3, 1, TypeProcessus::INTERACTIF),
+                               Processus("s", 1, 3, 1, TypeProcessus::SYSTEME)});
+  File<Processus> r = TP::mlfq(f, {8, 8, 8}, std::numeric_limits<int>::max(), 0);
+  std::vector<std::string> ordre;
+  for (const Processus& p : r) ordre.push_back(p.getId());
+  EXPECT_EQ((std::vector<std::string>{"s", "i", "u"}), ordre);
+  EXPECT_EQ(4, r.getValeur(0).getFin());
+}
+
+TEST(Simulation, mlfq_relevement_evite_la_famine) {
+  TableProcessus sans;
+  sans.ajouter("lent", 0, 3, 1, TypeProcessus::UTILISATEUR);
+  for (int k = 0; k < 30; ++k) sans.ajouter("sys" + std::to_string(k), k, 1, 1, TypeProcessus::SYSTEME);
+  TableProcessus avec = sans;
+  TP::mlfq(sans, {4, 8}, std::numeric_limits<int>::max(), 0);
+  TP::mlfq(avec, {4, 8}, 10, 0);
+  EXPECT_EQ(30, sans.attentes()[0]);
+  EXPECT_EQ(10, avec.attentes()[0]);
+}
+
+TEST(Simulation, entree_vide) {
+  TableProcessus table;
+  PolitiqueFcfs politique;
+  EXPECT_TRUE(simuler(table, politique, 0).empty());
+  EXPECT_EQ(0, TP::fcfs(File<Processus>(), 0).taille());
+}
+
+TEST(Simulation, arret_anticipe_apres_trois_fins) {
+  TableProcessus table;
+  for (int i = 0; i < 6; ++i) table.ajouter("a" + std::to_string(i), i, 2, 1, TypeProcessus::BATCH);
+  PolitiqueFcfs politique;
+  int fins = 0;
+  auto arret = [&fins](uint32_t, int) { return ++fins == 3; };
+  std::vector<uint32_t> ordre = simuler(table, politique, 0, arret);
+  EXPECT_EQ((std::vector<uint32_t>{0, 1, 2}), ordre);
+  EXPECT_EQ(6, table.fins()[2]);
+  EXPECT_EQ(3, fins);
+}
+
+TEST(Simulation, stride_parts_proportionnelles_aux_tickets) {
+  TableProcessus table;
+  table.ajouter("s1", 0, 400, 0, TypeProcessus::SYSTEME);
+  table.ajouter("s2", 0, 400, 2, TypeProcessus::BATCH);
+  PartsParType parts;
+  std::vector<uint32_t> ordre = TP::stride(table, 1, 0, &parts);
+  // 3 tickets contre 1 : s2 reçoit les trois quarts du processeur et finit vers 533.
+  EXPECT_EQ((std::vector<uint32_t>{1, 0}), ordre);
+  EXPECT_NEAR(533, table.fins()[1], 2);
+  EXPECT_EQ(800, table.fins()[0]);
+  // Seuls les 533 premiers instants, où les deux types sont prêts, comptent.
+  for (size_t t = 0; t < PartsParType::TYPES; ++t) EXPECT_NEAR(parts.cible[t], parts.obtenue[t], 0.005);
+  EXPECT_NEAR(0.25, parts.obtenue[0], 0.005);
+  EXPECT_DOUBLE_EQ(0, parts.cible[1]);
+  EXPECT_LE(parts.retardMax[0], 1);
+  EXPECT_LE(parts.retardMax[2], 1);
+}
+
+TEST(Simulation, parts_ecart_loterie_superieur_a_stride) {
+  TableProcessus stride;
+  stride.ajouter("s1", 0, 400, 0, TypeProcessus::SYSTEME);
+  stride.ajouter("s2", 0, 400, 2, TypeProcessus::BATCH);
+  TableProcessus loterie = stride;
+  PartsParType partsStride;
+  PartsParType partsLoterie;
+  TP::stride(stride, 1, 0, &partsStride);
+  TP::loterie(loterie, 1, 7, 0, &partsLoterie);
+  // Mêmes parts cibles ; la loterie ne les respecte qu'en moyenne, et prend du retard.
+  EXPECT_NEAR(partsStride.cible[0], partsLoterie.cible[0], 0.05);
+  EXPECT_LE(partsStride.retardMax[0], 1);
+  EXPECT_GT(partsLoterie.retardMax[0], 4);
+}
+
+TEST(Simulation, stride_arrivant_ne_rattrape_pas_son_absence) {
+  TableProcessus table;
+  table.ajouter("s1", 0, 200, 0, TypeProcessus::BATCH);
+  table.ajouter("s2", 100, 10, 0, TypeProcessus::BATCH);
+  TP::stride(table, 1, 0);
+  // Mêmes tickets : à partir de 100, les deux alternent au lieu de laisser s2 seul ;
+  // s2 prend la passe du dernier élu, en retard d'une tranche sur s1, et commence.
+  EXPECT_EQ(119, table.fins()[1]);
+}
+
+TEST(Simulation, loterie_reproductible_et_proportionnelle) {
+  TableProcessus table;
+  table.ajouter("l1", 0, 2000, 0, TypeProcessus::INTERACTIF);
+  table.ajouter("l2", 0, 2000, 3, TypeProcessus::UTILISATEUR);
+  TableProcessus copie = table;
+  PartsParType parts;
+  TP::loterie(table, 1, 7, 0, &parts);
+  TP::loterie(copie, 1, 7, 0);
+  EXPECT_EQ(table.fins(), copie.fins());
+  // 4 tickets contre 1 : l2 finit vers 2500.
+  EXPECT_NEAR(2500, table.fins()[1], 100);
+  for (size_t t = 0; t < PartsParType::TYPES; ++t) EXPECT_NEAR(parts.cible[t], parts.obtenue[t], 0.03);
+}
+
+TEST(Simulation, loterie_tous_les_processus_terminent) {
+  TableProcessus table;
+  for (int i = 0; i < 300; ++i) {
+    table.ajouter("t" + std::to_string(i), (i * 17) % 50, i % 13 + 1, i % 10, static_cast<TypeProcessus>(i % 4 + 1));
+  }
+  std::vector<uint32_t> ordre = TP::loterie(table, 3, 2024, 0);
+  EXPECT_EQ(300, ordre.size());
+  std::vector<uint32_t> tri(ordre);
+  std::sort(tri.begin(), tri.end());
+  for (uint32_t i = 0; i < 300; ++i) EXPECT_EQ(i, tri[i]);
+}
+
+TEST(Simulation, edf_echeance_plus_proche_preempte) {
+  TableProcessus table;
+  table.ajouter("e1", 0, 10, 0, TypeProcessus::SYSTEME, 30);
+  table.ajouter("e2", 2, 3, 0, TypeProcessus::SYSTEME, 6);
+  table.ajouter("e3", 3, 2, 0, TypeProcessus::SYSTEME, 40);
+  std::vector<uint32_t> ordre = TP::edf(table, 0);
+  EXPECT_EQ((std::vector<uint32_t>{1, 0, 2}), ordre);
+  EXPECT_EQ(5, table.fins()[1]);
+  EXPECT_EQ(13, table.fins()[0]);
+  EXPECT_EQ(15, table.fins()[2]);
+  BilanEcheances bilan = table.bilanEcheances(5, 4);
+  EXPECT_EQ(3, bilan.avecEcheance);
+  EXPECT_EQ(0, bilan.manquees);
+  EXPECT_DOUBLE_EQ(0, bilan.tauxManque());
+}
+
+TEST(Simulation, edf_sans_echeance_passe_en_dernier) {
+  TableProcessus table;
+  table.ajouter("libre", 0, 4, 0, TypeProcessus::BATCH);
+  table.ajouter("rt", 1, 2, 0, TypeProcessus::SYSTEME, 100);
+  table.ajouter("libre2", 1, 1, 0, TypeProcessus::BATCH);
+  std::vector<uint32_t> ordre = TP::edf(table, 0);
+  // rt interrompt libre à son arrivée ; libre, redevenu prêt après libre2, passe après lui.
+  EXPECT_EQ((std::vector<uint32_t>{1, 2, 0}), ordre);
+  EXPECT_EQ(3, table.fins()[1]);
+  EXPECT_EQ(4, table.fins()[2]);
+  EXPECT_EQ(7, table.fins()[0]);
+  EXPECT_EQ(1, table.bilanEcheances(1, 1).avecEcheance);
+}
+
+TEST(Simulation, edf_bilan_echeances_manquees) {
+  TableProcessus table;
+  table.ajouter("a", 0, 4, 0, TypeProcessus::SYSTEME, 4);
+  table.ajouter("b", 0, 4, 0, TypeProcessus::SYSTEME, 5);
+  table.ajouter("c", 0, 4, 0, TypeProcessus::SYSTEME, 6);
+  table.ajouter("d", 0, 10, 0, TypeProcessus::SYSTEME, 7);
+  TP::edf(table, 0);
+  // Charge infaisable : retards 0, 3, 6 et 15.
+  BilanEcheances bilan = table.bilanEcheances(5, 3);
+  EXPECT_EQ(4, bilan.avecEcheance);
+  EXPECT_EQ(3, bilan.manquees);
+  EXPECT_EQ(24, bilan.retardTotal);
+  EXPECT_EQ(15, bilan.retardMax);
+  EXPECT_DOUBLE_EQ(0.75, bilan.tauxManque());
+  EXPECT_EQ((std::vector<size_t>{1, 1, 1}), bilan.histogramme);
+  BilanEcheances large = table.bilanEcheances(3);
+  EXPECT_EQ(3, large.histogramme.size());
+  EXPECT_EQ(3u, std::accumulate(large.histogramme.begin(), large.histogramme.end(), size_t{0}));
+}
+
+TEST(Simulation, edf_file_conserve_les_echeances) {
+  File<Processus> entree = charger({Processus("p1", 0, 3, 1, TypeProcessus::SYSTEME, 9),
+                                    Processus("p2", 1, 1, 1, TypeProcessus::SYSTEME, 2)});
+  BilanEcheances bilan;
+  File<Processus> sortie = TP::edf(entree, 0, &bilan);
+  EXPECT_EQ("p2", sortie.getValeur(0).getId());
+  EXPECT_EQ(2, sortie.getValeur(0).getEcheance());
+  EXPECT_EQ(9, sortie.getValeur(1).getEcheance());
+  EXPECT_EQ(0, bilan.manquees);
+  EXPECT_EQ(2, bilan.avecEcheance);
+}
+
+TEST(Simulation, cfs_poids_selon_la_priorite) {
+  TableProcessus table;
+  table.ajouter("n0", 0, 1, 0, TypeProcessus::BATCH);
+  table.ajouter("n-5", 0, 1, 5, TypeProcessus::BATCH);
+  table.ajouter("n-20", 0, 1, 40, TypeProcessus::BATCH);
+  EXPECT_EQ(PolitiqueCfs::POIDS_REFERENCE, poidsCfs(table, 0));
+  EXPECT_EQ(3121, poidsCfs(table, 1));
+  EXPECT_EQ(88761, poidsCfs(table, 2));
+}
+
+TEST(Simulation, cfs_partage_proportionnel_aux_poids) {
+  TableProcessus table;
+  table.ajouter("faible", 0, 400, 0, TypeProcessus::BATCH);
+  table.ajouter("fort", 0, 400, 5, TypeProcessus::BATCH);
+  std::vector<uint32_t> ordre = TP::cfs(table, 24, 2, 0);
+  // Poids 3121 contre 1024 : fort reçoit environ 75 % du processeur et finit vers 531.
+  EXPECT_EQ((std::vector<uint32_t>{1, 0}), ordre);
+  EXPECT_NEAR(531, table.fins()[1], 24);
+  EXPECT_EQ(800, table.fins()[0]);
+}
+
+TEST(Simulation, cfs_arrivant_preempte_et_ne_rattrape_pas) {
+  TableProcessus table;
+  table.ajouter("long", 0, 100, 0, TypeProcessus::BATCH);
+  table.ajouter("court", 10, 2, 0, TypeProcessus::BATCH);
+  table.ajouter("tard", 50, 40, 0, TypeProcessus::BATCH);
+  TP::cfs(table, 6, 1, 0);
+  // court part du temps virtuel minimal (6) et interrompt long, en avance de 4 unités.
+  EXPECT_EQ(12, table.fins()[1]);
+  // tard ne reçoit pas à lui seul les 50 unités d'avance de long : ils alternent
+  // jusqu'à sa fin, vers 130, au lieu de le laisser seul jusqu'en 90.
+  EXPECT_NEAR(130, table.fins()[2], 3);
+  EXPECT_EQ(142, table.fins()[0]);
+}
+
+TEST(Simulation, cfs_latence_et_granularite) {
+  TableProcessus table;
+  for (int i = 0; i < 4; ++i) table.ajouter("c" + std::to_string(i), 0, 12, 0, TypeProcessus::BATCH);
+  TableProcessus petite = table;
+  TP::cfs(table, 12, 1, 0);
+  // Période de 12 pour 4 prêts : des tranches de 3, donc des fins groupées en 39 à 48.
+  EXPECT_EQ(39, table.fins()[0]);
+  EXPECT_EQ(48, table.fins()[3]);
+  // Granularité 12 : la période s'allonge à 48 et chacun passe d'une traite.
+  TP::cfs(petite, 12, 12, 0);
+  EXPECT_EQ((std::vector<int>{12, 24, 36, 48}), petite.fins());
+}
+
+TEST(Simulation, commutation_cout_fixe) {
+  TableProcessus table;
+  table.ajouter("a", 0, 4, 1, TypeProcessus::BATCH);
+  table.ajouter("b", 0, 4, 1, TypeProcessus::BATCH);
+  BilanProcesseur bilan{};
+  TP::round_robin(table, 2, 0, CoutCommutation{1, 0, 0}, &bilan);
+  EXPECT_EQ((std::vector<int>{9, 12}), table.fins());
+  EXPECT_EQ(4, bilan.commutations);
+  EXPECT_EQ(4, bilan.surcout);
+  EXPECT_EQ((std::vector<int>{5, 8}), table.attentes());
+}
+
+TEST(Simulation, commutation_reelire_le_meme_est_gratuit) {
+  TableProcessus table;
+  table.ajouter("seul", 0, 10, 1, TypeProcessus::BATCH);
+  BilanProcesseur bilan{};
+  TP::round_robin(table, 2, 0, CoutCommutation{1, 0, 0}, &bilan);
+  EXPECT_EQ(11, table.fins()[0]);
+  EXPECT_EQ(1, bilan.commutations);
+}
+
+TEST(Simulation, commutation_rechauffement_selon_l_absence) {
+  TableProcessus table;
+  table.ajouter("a", 0, 4, 1, TypeProcessus::BATCH);
+  table.ajouter("b", 0, 4, 1, TypeProcessus::BATCH);
+  BilanProcesseur bilan{};
+  TP::round_robin(table, 2, 0, CoutCommutation{0, 10, 20}, &bilan);
+  // Premières élections à froid (10) ; puis a revient après 12 d'absence (6), b après 8 (4).
+  EXPECT_EQ((std::vector<int>{32, 38}), table.fins());
+  EXPECT_EQ(30, bilan.surcout);
+}
+
+TEST(Simulation, commutation_interrompue_par_une_preemption) {
+  TableProcessus table;
+  table.ajouter("long", 0, 10, 1, TypeProcessus::BATCH);
+  table.ajouter("court", 1, 1, 1, TypeProcessus::BATCH);
+  BilanProcesseur bilan{};
+  std::vector<uint32_t> ordre = TP::srtf(table, 0, CoutCommutation{3, 0, 0}, &bilan);
+  // court arrive pendant la commutation vers long : seule 1 unité en est perdue.
+  EXPECT_EQ((std::vector<uint32_t>{1, 0}), ordre);
+  EXPECT_EQ(5, table.fins()[1]);
+  EXPECT_EQ(18, table.fins()[0]);
+  EXPECT_EQ(3, bilan.commutations);
+  EXPECT_EQ(7, bilan.surcout);
+}
+
+TEST(Simulation, commutation_ne_retarde_pas_le_vieillissement) {
+  TableProcessus table;
+  table.ajouter("haut", 0, 100, 1, TypeProcessus::BATCH);
+  table.ajouter("bas", 0, 5, 0, TypeProcessus::BATCH);
+  PolitiquePrioriteVieillissement politique(table, 10);
+  BilanProcesseur bilan{};
+  simuler(table, politique, 0, CoutCommutation{3, 0, 0}, &bilan);
+  // bas dépasse haut à 20 comme sans commutation, puis paie la sienne.
+  EXPECT_EQ(28, table.fins()[1]);
+  EXPECT_EQ(3, bilan.commutations);
+}
+
+TEST(Simulation, commutation_cfs_meme_tranche_avec_ou_sans_arrivee) {
+  TableProcessus seuls;
+  seuls.ajouter("a", 0, 59, 20, TypeProcessus::BATCH);
+  seuls.ajouter("b", 0, 59, 20, TypeProcessus::BATCH);
+  TableProcessus avecArrivee = seuls;
+  avecArrivee.ajouter("tard", 5, 1, 0, TypeProcessus::BATCH);
+  PolitiqueCfs cfsSeuls(seuls, 120, 2);
+  PolitiqueCfs cfsArrivee(avecArrivee, 120, 2);
+  BilanProcesseur bilan{};
+  simuler(seuls, cfsSeuls, 0, CoutCommutation{2, 0, 0}, &bilan);
+  simuler(avecArrivee, cfsArrivee, 0, CoutCommutation{2, 0, 0}, &bilan);
+  // La part de a (60, ou 59 une fois tard arrivé) court depuis son élection,
+  // commutation comprise : a progresse de 2 à 60 ou 59, et ne finit pas dans
+  // sa première tranche, avec ou sans l'arrivée de tard. La part de tard (2)
+  // est couverte par sa commutation : il progresse quand même d'une unité.
+  EXPECT_EQ(123, seuls.fins()[0]);
+  EXPECT_EQ(67, avecArrivee.fins()[2]);
+  EXPECT_EQ(125, avecArrivee.fins()[0]);
+}
+
+TEST(Simulation, commutation_plus_chere_que_la_part_cfs) {
+  TableProcessus table;
+  table.ajouter("a", 0, 5, 0, TypeProcessus::BATCH);
+  table.ajouter("b", 0, 5, 0, TypeProcessus::BATCH);
+  BilanProcesseur bilan{};
+  TP::cfs(table, 2, 1, 0, CoutCommutation{1, 0, 0}, &bilan);
+  // La part de chacun (1) est couverte par la commutation : chaque élu progresse
+  // quand même d'une unité, en alternance.
+  EXPECT_EQ((std::vector<int>{18, 20}), table.fins());
+  EXPECT_EQ(10, bilan.commutations);
+  EXPECT_EQ(10, bilan.surcout);
+}
+
+TEST(Simulation, commutation_gratuite_par_defaut) {
+  TableProcessus table;
+  for (int i = 0; i < 20; ++i) table.ajouter("g" + std::to_string(i), i % 7, i % 5 + 1, i % 3, TypeProcessus::BATCH);
+  TableProcessus avecBilan = table;
+  BilanProcesseur bilan{};
+  TP::mlfq(table, {2, 4, 8}, 30, 0);
+  TP::mlfq(avecBilan, {2, 4, 8}, 30, 0, CoutCommutation(), &bilan);
+  EXPECT_EQ(table.fins(), avecBilan.fins());
+  EXPECT_EQ(0, bilan.commutations);
+  EXPECT_EQ(0, bilan.surcout);
+}
+
+TEST(Simulation, entrees_sorties_blocage_et_reveil) {
+  TableProcessus table;
+  table.ajouter("io", 0, 5, 1, TypeProcessus::INTERACTIF);
+  table.ajouter("calcul", 0, 4, 1, TypeProcessus::BATCH);
+  table.definirRafales(0, {2, 5, 3});
+  BilanProcesseur bilan{};
+  std::vector<uint32_t> ordre = TP::fcfs(table, 0, CoutCommutation(), &bilan);
+  // io calcule de 0 à 2, attend son périphérique jusqu'à 7 pendant que calcul s'exécute, puis finit à 10.
+  EXPECT_EQ((std::vector<uint32_t>{1, 0}), ordre);
+  EXPECT_EQ((std::vector<int>{10, 6}), table.fins());
+  EXPECT_EQ((std::vector<int>{0, 2}), table.attentes());
+  EXPECT_EQ(10, bilan.duree);
+  EXPECT_EQ(9, bilan.occupation);
+  EXPECT_EQ(5, bilan.entreesSorties);
+  EXPECT_EQ(4, bilan.chevauchement);
+  EXPECT_DOUBLE_EQ(0.9, bilan.utilisation());
+  EXPECT_DOUBLE_EQ(0.8, bilan.recouvrement());
+}
+
+TEST(Simulation, entrees_sorties_reveil_preempte) {
+  TableProcessus table;
+  table.ajouter("io", 0, 2, 1, TypeProcessus::INTERACTIF);
+  table.ajouter("long", 0, 10, 1, TypeProcessus::BATCH);
+  table.definirRafales(0, {1, 3, 1});
+  std::vector<uint32_t> ordre = TP::srtf(table, 0);
+  // Réveillé à 4 avec 1 unité restante, io interrompt long (7 restantes).
+  EXPECT_EQ((std::vector<uint32_t>{0, 1}), ordre);
+  EXPECT_EQ((std::vector<int>{5, 12}), table.fins());
+  EXPECT_EQ(0, table.attentes()[0]);
+}
+
+TEST(Simulation, entrees_sorties_processeur_inactif) {
+  TableProcessus table;
+  table.ajouter("io", 0, 4, 1, TypeProcessus::INTERACTIF);
+  table.definirRafales(0, {2, 6, 2});
+  BilanProcesseur bilan{};
+  TP::round_robin(table, 4, 0, CoutCommutation(), &bilan);
+  EXPECT_EQ(10, table.fins()[0]);
+  EXPECT_EQ(0, table.attentes()[0]);
+  EXPECT_EQ(6, bilan.entreesSorties);
+  EXPECT_EQ(0, bilan.chevauchement);
+  EXPECT_DOUBLE_EQ(0.4, bilan.utilisation());
+}
+
+TEST(Simulation, entrees_sorties_une_seule_rafale_identique) {
+  TableProcessus table;
+  for (int i = 0; i < 20; ++i) table.ajouter("r" + std::to_string(i), i % 7, i % 5 + 1, i % 3, TypeProcessus::BATCH);
+  TableProcessus rafales = table;
+  for (uint32_t i = 0; i < rafales.taille(); ++i) rafales.definirRafales(i, {rafales.durees()[i]});
+  EXPECT_FALSE(rafales.aDesEntreesSorties());
+  BilanProcesseur bilan{};
+  TP::round_robin(table, 2, 0);
+  TP::round_robin(rafales, 2, 0, CoutCommutation(), &bilan);
+  EXPECT_EQ(table.fins(), rafales.fins());
+  EXPECT_EQ(std::accumulate(table.durees().begin(), table.durees().end(), 0LL), bilan.occupation);
+  EXPECT_EQ(0, bilan.entreesSorties);
+  EXPECT_EQ(0, bilan.recouvrement());
+}
+
+TEST(Simulation, mlfq_ne_compte_pas_les_entrees_sorties) {
+  TableProcessus table;
+  table.ajouter("interactif", 0, 3, 1, TypeProcessus::SYSTEME);
+  table.ajouter("gourmand", 0, 6, 1, TypeProcessus::SYSTEME);
+  table.ajouter("calcul", 0, 10, 1, TypeProcessus::SYSTEME);
+  table.definirRafales(0, {1, 3, 1, 3, 1});
+  table.definirRafales(1, {2, 1, 2, 1, 2});
+  PolitiqueMlfq politique(table, {4, 8}, 1000);
+  simuler(table, politique, 0);
+  // Seul le calcul consommé compte dans le quantum : 3 unités gardent interactif au niveau 0.
+  EXPECT_EQ(0, politique.niveau(0));
+  EXPECT_EQ(1, politique.niveau(1));
+  EXPECT_EQ(1, politique.niveau(2));
+}
+
+TEST(Simulation, cfs_reveil_sans_payer_l_entree_sortie) {
+  TableProcessus table;
+  table.ajouter("io", 0, 2, 0, TypeProcessus::INTERACTIF);
+  table.ajouter("calcul", 0, 30, 0, TypeProcessus::BATCH);
+  table.definirRafales(0, {1, 10, 1});
+  TP::cfs(table, 12, 2, 0);
+  // Réveillé à 11 avec 1 de temps virtuel contre 10 pour calcul : io passe aussitôt.
+  EXPECT_EQ(12, table.fins()[0]);
+  EXPECT_EQ(0, table.attentes()[0]);
+  EXPECT_EQ(32, table.fins()[1]);
+}
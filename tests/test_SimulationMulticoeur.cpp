@@ -0,0 +1,167 @@
+//
+// Created by Vincent on 10/1/2024.
+//
+
+#include "gtest/gtest.h"
+#include "Politiques.h"
+#include "Simulation.h"
+#include "SimulationMulticoeur.h"
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace {
+  TableProcessus charge() {
+    TableProcessus table;
+    const TypeProcessus types[] = {TypeProcessus::SYSTEME, TypeProcessus::INTERACTIF, TypeProcessus::BATCH,
+                                   TypeProcessus::UTILISATEUR};
+    for (int i = 0; i < 200; ++i) {
+      table.ajouter("m" + std::to_string(i), (i * 37) % 11 + i * 3, i % 9 + 1, i % 5, types[i % 4]);
+    }
+    return table;
+  }
+
+  TableProcessus chargeSimultanee() {
+    TableProcessus table;
+    for (int i = 0; i < 60; ++i) {
+      table.ajouter("v" + std::to_string(i), 0, (i * 7) % 13 + 1, i % 5, TypeProcessus::BATCH);
+    }
+    return table;
+  }
+
+  template <typename Fabrique>
+  void comparerAuMonocoeur(Fabrique fabrique) {
+    TableProcessus mono = charge();
+    TableProcessus multi = mono;
+    auto politique = fabrique(mono);
+    std::vector<uint32_t> ordre = simuler(mono, politique, 0);
+    StatistiquesMulticoeur stats = simulerMulticoeur(multi, fabrique(multi),
+                                                     ConfigMulticoeur{1, Equilibrage::FILE_GLOBALE, 5}, 0);
+    EXPECT_EQ(ordre, stats.ordre);
+    EXPECT_EQ(mono.fins(), multi.fins());
+    EXPECT_EQ(0, stats.migrations);
+  }
+
+  template <typename Politique>
+  void verifierVolDeTravail(const Politique& prototype, TableProcessus& table) {
+    StatistiquesMulticoeur stats = simulerMulticoeur(table, prototype,
+                                                     ConfigMulticoeur{4, Equilibrage::VOL_DE_TRAVAIL, 1}, 0);
+    ASSERT_EQ(table.taille(), stats.ordre.size());
+    EXPECT_GT(stats.vols, 0);
+    long long travail = std::accumulate(table.durees().begin(), table.durees().end(), 0LL);
+    EXPECT_EQ(travail, std::accumulate(stats.occupation.begin(), stats.occupation.end(), 0LL));
+    for (size_t i = 0; i < table.taille(); ++i) {
+      EXPECT_EQ(table.fins()[i], table.arrivees()[i] + table.durees()[i] + table.attentes()[i]);
+    }
+  }
+}
+
+TEST(SimulationMulticoeur, un_coeur_egale_simuler) {
+  comparerAuMonocoeur([](TableProcessus&) { return PolitiqueFcfs(); });
+  comparerAuMonocoeur([](TableProcessus&) { return PolitiqueTourniquet(3); });
+  comparerAuMonocoeur([](TableProcessus& t) { return PolitiqueTas<ParDuree>(t); });
+  comparerAuMonocoeur([](TableProcessus& t) { return PolitiqueSrtf(t); });
+  comparerAuMonocoeur([](TableProcessus& t) { return PolitiquePrioriteVieillissement(t, 10); });
+  comparerAuMonocoeur([](TableProcessus& t) { return PolitiqueMultiniveaux(t, 3); });
+  comparerAuMonocoeur([](TableProcessus& t) { return PolitiqueMlfq(t, {2, 4, 8}, 40); });
+  comparerAuMonocoeur([](TableProcessus& t) { return PolitiqueLoterie(t, 3, 11); });
+  comparerAuMonocoeur([](TableProcessus& t) { return PolitiqueStride(t, 3); });
+  comparerAuMonocoeur([](TableProcessus& t) { return PolitiqueEdf(t); });
+  comparerAuMonocoeur([](TableProcessus& t) { return PolitiqueCfs(t, 12, 2); });
+}
+
+TEST(SimulationMulticoeur, file_globale_deux_coeurs) {
+  TableProcessus table;
+  for (int i = 0; i < 4; ++i) table.ajouter("g" + std::to_string(i), 0, 4, 1, TypeProcessus::BATCH);
+  StatistiquesMulticoeur stats = simulerMulticoeur(table, PolitiqueFcfs(),
+                                                   ConfigMulticoeur{2, Equilibrage::FILE_GLOBALE, 0}, 0);
+  EXPECT_EQ((std::vector<int>{4, 4, 8, 8}), table.fins());
+  EXPECT_EQ(8, stats.duree);
+  EXPECT_DOUBLE_EQ(1, stats.utilisationMoyenne());
+  EXPECT_DOUBLE_EQ(0, stats.desequilibre());
+}
+
+TEST(SimulationMulticoeur, vol_de_travail) {
+  TableProcessus sansVol;
+  sansVol.ajouter("long", 0, 10, 1, TypeProcessus::BATCH);
+  sansVol.ajouter("c1", 0, 1, 1, TypeProcessus::BATCH);
+  sansVol.ajouter("c2", 0, 1, 1, TypeProcessus::BATCH);
+  sansVol.ajouter("c3", 0, 1, 1, TypeProcessus::BATCH);
+  TableProcessus avecVol = sansVol;
+
+  StatistiquesMulticoeur sans = simulerMulticoeur(sansVol, PolitiqueFcfs(),
+                                                  ConfigMulticoeur{2, Equilibrage::FILES_PAR_COEUR, 0}, 0);
+  StatistiquesMulticoeur avec = simulerMulticoeur(avecVol, PolitiqueFcfs(),
+                                                  ConfigMulticoeur{2, Equilibrage::VOL_DE_TRAVAIL, 0}, 0);
+  EXPECT_EQ(11, sansVol.fins()[2]);
+  EXPECT_EQ(3, avecVol.fins()[2]);
+  EXPECT_EQ(0, sans.vols);
+  EXPECT_EQ(1, avec.vols);
+  EXPECT_LT(avec.desequilibre(), sans.desequilibre());
+}
+
+TEST(SimulationMulticoeur, cout_de_migration) {
+  TableProcessus table;
+  for (int i = 0; i < 3; ++i) table.ajouter("r" + std::to_string(i), 0, 2, 1, TypeProcessus::BATCH);
+  StatistiquesMulticoeur stats = simulerMulticoeur(table, PolitiqueTourniquet(1),
+                                                   ConfigMulticoeur{2, Equilibrage::FILE_GLOBALE, 1}, 0);
+  EXPECT_EQ(3, stats.migrations);
+  EXPECT_EQ(3, std::accumulate(stats.surcout.begin(), stats.surcout.end(), 0LL));
+  EXPECT_EQ(6, std::accumulate(stats.occupation.begin(), stats.occupation.end(), 0LL));
+  EXPECT_EQ((std::vector<int>{3, 4, 5}), table.fins());
+  EXPECT_EQ(5, stats.duree);
+}
+
+TEST(SimulationMulticoeur, mlfq_etat_partage_entre_coeurs) {
+  TableProcessus table = charge();
+  verifierVolDeTravail(PolitiqueMlfq(table, {2, 4, 8}, std::numeric_limits<int>::max()), table);
+}
+
+TEST(SimulationMulticoeur, vol_de_travail_stride_et_cfs) {
+  // Le voleur calcule la tranche de l'élu à partir de l'état partagé des copies.
+  TableProcessus stride = chargeSimultanee();
+  verifierVolDeTravail(PolitiqueStride(stride, 3), stride);
+  TableProcessus cfs = chargeSimultanee();
+  verifierVolDeTravail(PolitiqueCfs(cfs, 12, 2), cfs);
+}
+
+TEST(SimulationMulticoeur, stride_passe_partagee_entre_copies) {
+  TableProcessus table;
+  table.ajouter("s0", 0, 8, 1, TypeProcessus::BATCH);
+  table.ajouter("s1", 0, 8, 1, TypeProcessus::BATCH);
+  PolitiqueStride coeur0(table, 4);
+  PolitiqueStride coeur1 = coeur0;
+  coeur0.ajouter(0, 0);
+  EXPECT_EQ(0u, coeur0.extraire(0));
+  // s0 rend son quantum à l'autre cœur : sa passe y avance, et s1 passe devant.
+  coeur1.ajouter(0, 4);
+  coeur1.ajouter(1, 4);
+  EXPECT_EQ(1u, coeur1.extraire(4));
+}
+
+TEST(SimulationMulticoeur, cfs_temps_virtuel_partage_entre_copies) {
+  TableProcessus table;
+  table.ajouter("c0", 0, 8, 0, TypeProcessus::BATCH);
+  table.ajouter("c1", 0, 8, 0, TypeProcessus::BATCH);
+  PolitiqueCfs coeur0(table, 12, 2);
+  PolitiqueCfs coeur1 = coeur0;
+  coeur0.ajouter(0, 0);
+  EXPECT_EQ(0u, coeur0.extraire(0));
+  // c0 s'est exécuté 6 unités sur l'autre cœur : c1 passe devant.
+  coeur1.ajouter(0, 6);
+  coeur1.ajouter(1, 6);
+  EXPECT_EQ(1u, coeur1.extraire(6));
+}
+
+TEST(SimulationMulticoeur, migration_plus_chere_que_la_part_cfs) {
+  TableProcessus table = chargeSimultanee();
+  // Une migration de 10 couvre toute part CFS (au plus 2) : chaque élu progresse
+  // quand même d'une unité, et la simulation se termine.
+  StatistiquesMulticoeur stats = simulerMulticoeur(table, PolitiqueCfs(table, 2, 1),
+                                                   ConfigMulticoeur{2, Equilibrage::FILE_GLOBALE, 10}, 0);
+  ASSERT_EQ(table.taille(), stats.ordre.size());
+  EXPECT_GT(stats.migrations, 0);
+  long long travail = std::accumulate(table.durees().begin(), table.durees().end(), 0LL);
+  EXPECT_EQ(travail, std::accumulate(stats.occupation.begin(), stats.occupation.end(), 0LL));
+}
@@ -0,0 +1,137 @@
+//
+// Created by Vincent on 10/1/2024.
+//
+
+#include "gtest/gtest.h"
+#include "TableProcessus.h"
+#include "Ordonnanceur.h"
+#include "TableIdentifiants.h"
+#include "TableRafales.h"
+#include <vector>
+
+class TableProcessusTest : public ::testing::Test {
+  protected:
+  void SetUp() override {
+    F.insererDernier(Processus("p1", 0, 8, 2, TypeProcessus::SYSTEME));
+    F.insererDernier(Processus("p2", 1, 4, 5, TypeProcessus::INTERACTIF));
+    F.insererDernier(Processus("p3", 1, 2, 1, TypeProcessus::BATCH));
+    F.insererDernier(Processus("p10", 3, 6, 5, TypeProcessus::UTILISATEUR));
+    F.insererDernier(Processus("p5", 3, 6, 3, TypeProcessus::BATCH));
+  }
+
+  static void comparer(const File<Processus>& attendu, const File<Processus>& obtenu) {
+    ASSERT_EQ(attendu.taille(), obtenu.taille());
+    for (size_t i = 0; i < attendu.taille(); ++i) {
+      EXPECT_EQ(attendu.getValeur(i).getId(), obtenu.getValeur(i).getId());
+      EXPECT_EQ(attendu.getValeur(i).getAttente(), obtenu.getValeur(i).getAttente());
+      EXPECT_EQ(attendu.getValeur(i).getFin(), obtenu.getValeur(i).getFin());
+    }
+    EXPECT_FLOAT_EQ(attendu.getTempsMoy(), obtenu.getTempsMoy());
+  }
+
+  File<Processus> F;
+};
+
+TEST(TableProcessus, constructeur_vide) {
+  TableProcessus t;
+  EXPECT_TRUE(t.estVide());
+  EXPECT_EQ(0, t.taille());
+  EXPECT_EQ(0, t.tempsAttenteMoyen());
+}
+
+TEST_F(TableProcessusTest, colonnes_et_identifiants) {
+  TableProcessus t(F);
+  ASSERT_EQ(5, t.taille());
+  EXPECT_EQ("p10", t.getId(3));
+  EXPECT_EQ("p5", t[4].getId());
+  EXPECT_EQ(3, t.arrivees()[3]);
+  EXPECT_EQ(4, t[1].getDuree());
+  EXPECT_EQ(TypeProcessus::BATCH, t.types()[2]);
+}
+
+TEST_F(TableProcessusTest, fcfs_fjs_priorite_identiques_a_la_file) {
+  TableProcessus tFcfs(F);
+  comparer(TP::fcfs(F, 2), tFcfs.versFile(TP::fcfs(tFcfs, 2)));
+
+  TableProcessus tFjs(F);
+  comparer(TP::fjs(F, 0), tFjs.versFile(TP::fjs(tFjs, 0)));
+
+  TableProcessus tPrio(F);
+  comparer(TP::priorite(F, 0), tPrio.versFile(TP::priorite(tPrio, 0)));
+}
+
+TEST(TableProcessus, ajouter_invalide) {
+  TableProcessus t;
+  EXPECT_THROW(t.ajouter("", 0, 1, 0, TypeProcessus::BATCH), PreconditionException);
+  EXPECT_THROW(t.ajouter("p1", 0, 0, 0, TypeProcessus::BATCH), PreconditionException);
+}
+
+TEST(TableIdentifiants, internement_stable) {
+  uint32_t a = TableIdentifiants::globale().interner("p42");
+  uint32_t b = TableIdentifiants::globale().interner("p43");
+  EXPECT_NE(a, b);
+  EXPECT_EQ(a, TableIdentifiants::globale().interner("p42"));
+  EXPECT_EQ("p43", TableIdentifiants::globale().nom(b));
+}
+
+TEST(TableIdentifiants, egalite_par_poignee) {
+  Processus p("p42", 0, 5, 1, TypeProcessus::BATCH);
+  Processus q("p42", 7, 2, 3, TypeProcessus::SYSTEME);
+  Processus r("p43", 0, 5, 1, TypeProcessus::BATCH);
+  EXPECT_TRUE(p == q);
+  EXPECT_FALSE(p == r);
+  EXPECT_EQ(p.getPid(), q.getPid());
+  EXPECT_EQ("p42", q.getId());
+}
+
+TEST(TableProcessus, rafales_et_aller_retour_par_la_file) {
+  Processus p("io", 0, 9, 1, TypeProcessus::INTERACTIF);
+  p.setRafales({2, 5, 3, 1, 4});
+  EXPECT_EQ(9, p.getDuree());
+  EXPECT_EQ(6, p.getEntreesSorties());
+
+  File<Processus> f;
+  f.insererDernier(Processus("calcul", 0, 3, 1, TypeProcessus::BATCH));
+  f.insererDernier(p);
+  TableProcessus t(f);
+  EXPECT_TRUE(t.aDesEntreesSorties());
+  EXPECT_EQ(1, t.nombreRafales(0));
+  EXPECT_EQ(3, t.rafale(0, 0));
+  EXPECT_EQ(0, t.entreesSorties(0));
+  EXPECT_EQ(5, t.nombreRafales(1));
+  EXPECT_EQ(9, t.durees()[1]);
+  EXPECT_EQ(6, t.entreesSorties(1));
+  EXPECT_EQ((std::vector<int>{2, 5, 3, 1, 4}), t.rafales(1));
+  EXPECT_EQ((std::vector<int>{2, 5, 3, 1, 4}), t[1].versProcessus().getRafales());
+  EXPECT_FALSE(t[0].versProcessus().aEntreesSorties());
+  const TableProcessus& lecture = t;
+  EXPECT_EQ(9, lecture.versProcessus(1).getDuree());
+  EXPECT_EQ((std::vector<int>{2, 5, 3, 1, 4}), lecture.versProcessus(1).getRafales());
+}
+
+TEST(TableRafales, suites_identiques_partagees) {
+  TableRafales& table = TableRafales::globale();
+  uint32_t a = table.interner({4, 2, 4});
+  EXPECT_EQ(a, table.interner({4, 2, 4}));
+  EXPECT_NE(a, table.interner({4, 3, 4}));
+  EXPECT_EQ((std::vector<int>{4, 2, 4}), table.rafales(a));
+  EXPECT_EQ(2, table.entreesSorties(a));
+  EXPECT_THROW(table.interner({4}), PreconditionException);
+
+  // Le processus ne garde qu'une poignée : ses rafales ne grossissent ni ne suivent ses copies.
+  EXPECT_LE(sizeof(Processus), 10 * sizeof(int));
+  Processus p("io", 0, 8, 1, TypeProcessus::INTERACTIF);
+  p.setRafales({4, 2, 4});
+  Processus copie = p;
+  EXPECT_EQ((std::vector<int>{4, 2, 4}), copie.getRafales());
+}
+
+TEST(TableProcessus, rafales_invalides) {
+  TableProcessus t;
+  t.ajouter("p1", 0, 4, 0, TypeProcessus::BATCH);
+  EXPECT_THROW(t.definirRafales(0, {2, 3}), PreconditionException);
+  EXPECT_THROW(t.definirRafales(0, {2, 0, 2}), PreconditionException);
+  t.definirRafales(0, {1, 3, 1});
+  EXPECT_EQ(2, t.durees()[0]);
+  EXPECT_THROW(t.definirRafales(0, {1, 3, 1}), PreconditionException);
+}
@@ -0,0 +1,89 @@
+//
+// Created by Vincent on 10/1/2024.
+//
+
+#include "gtest/gtest.h"
+#include "TasIndexe.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+class TasIndexeTest : public ::testing::Test {
+  protected:
+  void SetUp() override {
+    h5 = T5.inserer(5);
+    h1 = T5.inserer(1);
+    h4 = T5.inserer(4);
+    h2 = T5.inserer(2);
+    h3 = T5.inserer(3);
+  }
+
+  TasIndexe<int> T0;
+  TasIndexe<int> T5;
+  TasIndexe<int>::Poignee h1, h2, h3, h4, h5;
+};
+
+TEST(TasIndexe, constructeur_vide) {
+  TasIndexe<int> t ;
+  EXPECT_TRUE(t.estVide());
+  EXPECT_EQ(0, t.taille());
+}
+
+TEST_F(TasIndexeTest, T5_extraction_ordonnee) {
+  std::vector<int> sortie;
+  while (!T5.estVide()) sortie.push_back(T5.extraireSommet());
+  EXPECT_EQ((std::vector<int>{1, 2, 3, 4, 5}), sortie);
+}
+
+TEST_F(TasIndexeTest, T5_diminuer_cle) {
+  T5.modifier(h5, 0);
+  EXPECT_EQ(h5, T5.poigneeSommet());
+  EXPECT_EQ(0, T5.sommet());
+}
+
+TEST_F(TasIndexeTest, T5_augmenter_cle) {
+  T5.modifier(h1, 10);
+  EXPECT_EQ(2, T5.extraireSommet());
+  EXPECT_EQ(10, T5.getValeur(h1));
+}
+
+TEST_F(TasIndexeTest, T5_supprimer_par_poignee) {
+  T5.supprimer(h2);
+  T5.supprimer(h1);
+  EXPECT_FALSE(T5.contient(h1));
+  EXPECT_TRUE(T5.contient(h3));
+  EXPECT_EQ(3, T5.taille());
+  EXPECT_EQ(3, T5.extraireSommet());
+}
+
+TEST(TasIndexe, egalites_sortent_dans_ordre_insertion) {
+  auto parCle = [](const std::pair<int, char>& a, const std::pair<int, char>& b) { return a.first < b.first; };
+  TasIndexe<std::pair<int, char>, decltype(parCle)> t(parCle);
+  t.inserer({1, 'a'});
+  t.inserer({0, 'b'});
+  t.inserer({1, 'c'});
+  t.inserer({0, 'd'});
+  t.inserer({1, 'e'});
+  std::string ordre;
+  while (!t.estVide()) ordre += t.extraireSommet().second;
+  EXPECT_EQ("bdace", ordre);
+}
+
+TEST(TasIndexe, tas_max_binaire_aleatoire) {
+  TasIndexe<int, std::greater<int>, 2> t ;
+  std::mt19937 gen(42);
+  std::vector<int> valeurs;
+  std::vector<TasIndexe<int, std::greater<int>, 2>::Poignee> poignees;
+  for (int i = 0; i < 500; ++i) {
+    valeurs.push_back(static_cast<int>(gen() % 1000));
+    poignees.push_back(t.inserer(valeurs.back()));
+  }
+  for (int i = 0; i < 500; i += 7) {
+    t.supprimer(poignees[i]);
+    valeurs[i] = -1;
+  }
+  std::sort(valeurs.begin(), valeurs.end(), std::greater<int>());
+  for (size_t i = 0; !t.estVide(); ++i) {
+    EXPECT_EQ(valeurs[i], t.extraireSommet());
+  }
+}
@@ -0,0 +1,78 @@
+//
+// Created by Vincent on 10/1/2024.
+//
+// Compilé une fois par niveau de VERIFICATION_STRUCTURES (voir tests/CMakeLists.txt).
+//
+
+#include "gtest/gtest.h"
+#include "File.h"
+#include "TasIndexe.h"
+#include <string>
+
+namespace {
+  /**
+   * \brief Ordre sur les entiers qu'un test peut rendre incohérent.
+   *
+   *        Une fois *incoherent vrai, tout élément doit sortir avant tout
+   *        autre : dès deux éléments, l'invariant complet du tas est faux,
+   *        mais ses invariants locaux restent vrais.
+   */
+  struct OrdreFaussable {
+    const bool* incoherent;
+    bool operator()(int a, int b) const { return *incoherent || a < b; }
+  };
+
+  /**
+   * \brief Compte les modifications acceptées par un tas incohérent avant détection.
+   * \param[in] maximum Nombre de modifications tentées.
+   * \return Le nombre de modifications faites sans InvariantException.
+   */
+  size_t modificationsAvantDetection(size_t maximum) {
+    bool incoherent = false;
+    TasIndexe<int, OrdreFaussable> tas(OrdreFaussable{&incoherent});
+    for (int i = 0; i < 4; ++i) tas.inserer(i);
+
+    incoherent = true;
+    for (size_t fait = 0; fait < maximum; ++fait) {
+      try {
+        tas.modifier(tas.poigneeSommet(), static_cast<int>(fait));
+      }
+      catch (const InvariantException&) {
+        return fait;
+      }
+    }
+    return maximum;
+  }
+}
+
+TEST(VerificationStructures, tas_incoherent_detecte_selon_le_niveau) {
+  size_t acceptees = modificationsAvantDetection(12);
+#if VERIFICATION_STRUCTURES >= 3
+  EXPECT_EQ(0u, acceptees);
+#elif VERIFICATION_STRUCTURES == 2
+  EXPECT_LT(acceptees, 4u);
+#else
+  EXPECT_EQ(12u, acceptees);
+#endif
+}
+
+TEST(VerificationStructures, file_coherente_acceptee_a_tous_les_niveaux) {
+  File<std::string> f ;
+  File<std::string> g ;
+  for (int i = 0; i < 20; ++i) f.insererDernier(std::to_string(i));
+  for (int i = 0; i < 10; ++i) f.supprimerPremier();
+  g.insererDernier("a");
+  g.insererDernier("b");
+  f.splice(f.cbegin(), g);
+  f.supprimer(f.cbegin());
+  EXPECT_EQ(11u, f.taille());
+  EXPECT_EQ("b", f.getValeur(0));
+  EXPECT_EQ("19", f.getDernier());
+}
+
+TEST(VerificationStructures, tas_coherent_accepte_a_tous_les_niveaux) {
+  TasIndexe<int> tas ;
+  for (int i = 20; i > 0; --i) tas.inserer(i);
+  for (int i = 1; i <= 10; ++i) EXPECT_EQ(i, tas.extraireSommet());
+  EXPECT_EQ(10u, tas.taille());
+}